@@ -17,6 +17,7 @@
 #include "rethrow_first_arg.hpp"
 #include "server_shutdown_asio.hpp"
 
+#include <agrpc/grpc_context_pool.hpp>
 #include <agrpc/health_check_service.hpp>
 #include <agrpc/register_callback_rpc_handler.hpp>
 #include <grpcpp/server.h>
@@ -24,13 +25,12 @@
 
 #include <memory>
 #include <thread>
-#include <vector>
 
 namespace asio = boost::asio;
 
 // begin-snippet: server-side-multi-threaded
 
-// Multi-threaded server handling unary requests using callback API and multiple GrpcContexts
+// Multi-threaded server handling unary requests using callback API and a pool of GrpcContexts
 
 // end-snippet
 
@@ -67,38 +67,23 @@ int main(int argc, const char** argv)
 
     helloworld::Greeter::AsyncService service;
     std::unique_ptr<grpc::Server> server;
-    std::vector<std::unique_ptr<agrpc::GrpcContext>> grpc_contexts;
 
-    {
-        grpc::ServerBuilder builder;
-        for (size_t i = 0; i < thread_count; ++i)
-        {
-            grpc_contexts.emplace_back(std::make_unique<agrpc::GrpcContext>(builder.AddCompletionQueue()));
-        }
-        builder.AddListeningPort(host, grpc::InsecureServerCredentials());
-        builder.RegisterService(&service);
-        agrpc::add_health_check_service(builder);
-        server = builder.BuildAndStart();
-        agrpc::start_health_check_service(*server, *grpc_contexts.front());
-    }
+    // Create one GrpcContext per thread
+    grpc::ServerBuilder builder;
+    agrpc::GrpcContextPool grpc_context_pool{builder, thread_count};
+    builder.AddListeningPort(host, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    agrpc::add_health_check_service(builder);
+    server = builder.BuildAndStart();
+    agrpc::start_health_check_service(*server, grpc_context_pool.get_context(0));
 
-    example::ServerShutdown shutdown{*server, *grpc_contexts.front()};
+    example::ServerShutdown shutdown{*server, grpc_context_pool.get_context(0)};
 
-    // Create one thread per GrpcContext.
-    std::vector<std::thread> threads;
-    for (size_t i = 0; i < thread_count; ++i)
+    for (size_t i = 0; i < grpc_context_pool.size(); ++i)
     {
-        threads.emplace_back(
-            [&, i]
-            {
-                auto& grpc_context = *grpc_contexts[i];
-                register_request_handler(grpc_context, service, shutdown);
-                grpc_context.run();
-            });
+        register_request_handler(grpc_context_pool.get_context(i), service, shutdown);
     }
 
-    for (auto& thread : threads)
-    {
-        thread.join();
-    }
-}
\ No newline at end of file
+    grpc_context_pool.start();
+    grpc_context_pool.join();
+}
@@ -70,6 +70,22 @@ asio::awaitable<void> timer_with_different_completion_tokens(agrpc::GrpcContext&
     /* [alarm-with-allocator-aware-awaitable] */
 }
 
+/* [alarm-with-task] */
+agrpc::Task<bool> agrpc_alarm_task(agrpc::Alarm& alarm)
+{
+    co_return co_await alarm.wait(std::chrono::system_clock::now() + std::chrono::seconds(1), agrpc::use_task);
+}
+
+void spawn_agrpc_alarm_task(agrpc::GrpcContext& grpc_context, agrpc::Alarm& alarm)
+{
+    agrpc::co_spawn(grpc_context.get_executor(), agrpc_alarm_task(alarm),
+                    [](std::exception_ptr, bool wait_ok)
+                    {
+                        silence_unused(wait_ok);
+                    });
+}
+/* [alarm-with-task] */
+
 // Explicitly formatted using `ColumnLimit: 90`
 // clang-format off
 /* [agrpc-alarm] */
@@ -289,3 +289,114 @@ void register_rpc_handler(agrpc::GrpcContext& grpc_context, example::v1::Example
         asio::detached);
 }
 /* [server-rpc-handler-with-arena] */
+
+/* [server-rpc-handler-with-rpc-arena] */
+template <class Handler>
+class RPCHandlerWithRPCArena
+{
+  public:
+    explicit RPCHandlerWithRPCArena(Handler handler) : handler_(std::move(handler)) {}
+
+    template <class... Args>
+    decltype(auto) operator()(Args&&... args)
+    {
+        return handler_(std::forward<Args>(args)...);
+    }
+
+    agrpc::RPCArena request_message_factory() { return {}; }
+
+  private:
+    Handler handler_;
+};
+
+void server_rpc_unary_callback_with_rpc_arena(agrpc::GrpcContext& grpc_context,
+                                              example::v1::Example::AsyncService& service)
+{
+    using RPC = agrpc::ServerRPC<&example::v1::Example::AsyncService::RequestUnary>;
+    agrpc::register_callback_rpc_handler<RPC>(
+        grpc_context, service,
+        RPCHandlerWithRPCArena{[](RPC::Ptr ptr, RPC::Request& request, agrpc::RPCArena& arena)
+                               {
+                                   // The request, the response and all operations share the memory of the arena
+                                   auto& response = arena.create<RPC::Response>();
+                                   response.set_integer(request.integer());
+                                   auto& rpc = *ptr;
+                                   rpc.finish(response, grpc::Status::OK,
+                                              arena.bind_allocator([p = std::move(ptr)](bool) {}));
+                               }},
+        asio::detached);
+}
+/* [server-rpc-handler-with-rpc-arena] */
+
+/* [server-rpc-handler-with-response-message-factory] */
+template <class Handler>
+class RPCHandlerWithPooledResponses
+{
+  public:
+    explicit RPCHandlerWithPooledResponses(Handler handler) : handler_(std::move(handler)) {}
+
+    template <class... Args>
+    decltype(auto) operator()(Args&&... args)
+    {
+        // for server-streaming rpcs args are: ServerRPC&, Request&, agrpc::PooledMessageFactory&
+        return handler_(std::forward<Args>(args)...);
+    }
+
+    agrpc::PooledMessageFactory response_message_factory() { return {}; }
+
+  private:
+    Handler handler_;
+};
+
+void server_rpc_server_streaming_with_pooled_responses(agrpc::GrpcContext& grpc_context,
+                                                       example::v1::Example::AsyncService& service)
+{
+    using RPC = agrpc::ServerRPC<&example::v1::Example::AsyncService::RequestServerStreaming>;
+    agrpc::register_awaitable_rpc_handler<RPC>(
+        grpc_context, service,
+        RPCHandlerWithPooledResponses{
+            [](RPC& rpc, RPC::Request& request, agrpc::PooledMessageFactory& factory) -> asio::awaitable<void>
+            {
+                for (int i{}; i != request.integer(); ++i)
+                {
+                    // The memory of a destroyed response is reused by the next one
+                    auto& response = factory.create<RPC::Response>();
+                    response.set_integer(i);
+                    const bool ok = co_await rpc.write(response);
+                    factory.destroy(response);
+                    if (!ok)
+                    {
+                        co_return;
+                    }
+                }
+                co_await rpc.finish(grpc::Status::OK);
+            }},
+        asio::detached);
+}
+/* [server-rpc-handler-with-response-message-factory] */
+
+/* [server-rpc-task-handler] */
+void server_rpc_bidi_streaming_task(agrpc::GrpcContext& grpc_context, example::v1::Example::AsyncService& service)
+{
+    using RPC = agrpc::ServerRPC<&example::v1::Example::AsyncService::RequestBidirectionalStreaming>;
+    agrpc::register_awaitable_rpc_handler<RPC>(
+        grpc_context, service,
+        [](RPC& rpc) -> agrpc::Task<void>
+        {
+            RPC::Request request;
+            // Requesting stop on the stop token cancels the rpc
+            std::stop_token stop_token = co_await agrpc::this_task::stop_token;
+            while (!stop_token.stop_requested() && co_await rpc.read(request, agrpc::use_task))
+            {
+                RPC::Response response;
+                response.set_integer(request.integer());
+                if (!co_await rpc.write(response, agrpc::use_task))
+                {
+                    co_return;
+                }
+            }
+            co_await rpc.finish(grpc::Status::OK, agrpc::use_task);
+        },
+        asio::detached);
+}
+/* [server-rpc-task-handler] */
@@ -30,7 +30,8 @@ AGRPC_NAMESPACE_BEGIN()
 /**
  * @brief I/O object for `grpc::Alarm`
  *
- * Wraps a [grpc::Alarm](https://grpc.github.io/grpc/cpp/classgrpc_1_1_alarm.html) as an I/O object.
+ * Wraps a [grpc::Alarm](https://grpc.github.io/grpc/cpp/classgrpc_1_1_alarm.html) as an I/O object. Alternatively,
+ * waits can be managed by a timer wheel of the GrpcContext, see GrpcContext::set_alarm_resolution().
  *
  * @tparam Executor The executor type, must be capable of referring to a GrpcContext.
  *
@@ -61,6 +62,21 @@ class BasicAlarm
      */
     explicit BasicAlarm(agrpc::GrpcContext& grpc_context) : executor_(grpc_context.get_executor()) {}
 
+    BasicAlarm(const BasicAlarm&) = delete;
+    BasicAlarm(BasicAlarm&&) = default;
+
+    /**
+     * @brief Destruct the BasicAlarm
+     *
+     * An outstanding wait completes with `false` if the alarm did not fire yet.
+     *
+     * @since 3.8.0
+     */
+    ~BasicAlarm() = default;
+
+    BasicAlarm& operator=(const BasicAlarm&) = delete;
+    BasicAlarm& operator=(BasicAlarm&&) = default;
+
     /**
      * @brief Wait until a specified deadline has been reached (lvalue overload)
      *
@@ -85,13 +101,14 @@ class BasicAlarm
         using Initiation = detail::GrpcSenderInitiation<detail::AlarmInitFunction<Deadline>>;
         if constexpr (std::is_same_v<agrpc::UseSender, detail::RemoveCrefT<CompletionToken>>)
         {
-            return detail::BasicSenderAccess::create(grpc_context(), Initiation{alarm_, deadline},
+            return detail::BasicSenderAccess::create(grpc_context(),
+                                                     Initiation{alarm_, timer_wheel_handle_, deadline},
                                                      detail::SenderAlarmSenderImplementation{});
         }
         else
         {
             return detail::async_initiate_sender_implementation(
-                grpc_context(), Initiation{alarm_, deadline},
+                grpc_context(), Initiation{alarm_, timer_wheel_handle_, deadline},
                 detail::GrpcSenderImplementation<detail::AlarmCancellationFunction>{},
                 static_cast<CompletionToken&&>(token));
         }
@@ -136,7 +153,7 @@ class BasicAlarm
      *
      * Thread-safe
      */
-    void cancel() { alarm_.Cancel(); }
+    void cancel() { detail::cancel_alarm(alarm_, timer_wheel_handle_); }
 
     /**
      * @brief Get the executor
@@ -162,6 +179,7 @@ class BasicAlarm
 
     Executor executor_;
     grpc::Alarm alarm_;
+    detail::AlarmTimerWheelHandle timer_wheel_handle_;
 };
 
 template <class = void>
@@ -31,15 +31,20 @@
 #include <agrpc/grpc_context.hpp>
 #include <agrpc/grpc_executor.hpp>
 #include <agrpc/notify_on_state_change.hpp>
+#include <agrpc/periodic_timer.hpp>
+#include <agrpc/pooled_message_factory.hpp>
 #include <agrpc/read.hpp>
 #include <agrpc/register_awaitable_rpc_handler.hpp>
 #include <agrpc/register_callback_rpc_handler.hpp>
 #include <agrpc/register_coroutine_rpc_handler.hpp>
 #include <agrpc/register_sender_rpc_handler.hpp>
 #include <agrpc/register_yield_rpc_handler.hpp>
+#include <agrpc/rpc_arena.hpp>
 #include <agrpc/rpc_type.hpp>
 #include <agrpc/run.hpp>
 #include <agrpc/server_rpc.hpp>
+#include <agrpc/stack_pool.hpp>
+#include <agrpc/task.hpp>
 #include <agrpc/test.hpp>
 #include <agrpc/use_sender.hpp>
 #include <agrpc/waiter.hpp>
@@ -22,6 +22,7 @@
 #include <agrpc/detail/forward.hpp>
 #include <agrpc/detail/initiate_sender_implementation.hpp>
 #include <agrpc/detail/name.hpp>
+#include <agrpc/detail/operation_slot.hpp>
 #include <agrpc/detail/rpc_type.hpp>
 #include <agrpc/grpc_executor.hpp>
 
@@ -422,7 +423,8 @@ template <class StubT, class RequestT, class ResponseT, template <class> class R
           detail::PrepareAsyncClientClientStreamingRequest<StubT, ResponderT<RequestT>, ResponseT>
               PrepareAsyncClientStreaming,
           class Executor>
-class ClientRPC<PrepareAsyncClientStreaming, Executor> : public detail::ClientRPCBase<ResponderT<RequestT>, Executor>
+class ClientRPC<PrepareAsyncClientStreaming, Executor> : public detail::ClientRPCBase<ResponderT<RequestT>, Executor>,
+                                                         private detail::RPCOperationSlot
 {
   private:
     using Responder = ResponderT<RequestT>;
@@ -558,7 +560,8 @@ class ClientRPC<PrepareAsyncClientStreaming, Executor> : public detail::ClientRP
     auto write(const RequestT& request, grpc::WriteOptions options, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientWriteSenderInitiation<RequestT>{request, options},
+            this->grpc_context(), this->operation_slot(),
+            detail::ClientWriteSenderInitiation<RequestT>{request, options},
             detail::ClientWriteSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -609,7 +612,7 @@ class ClientRPC<PrepareAsyncClientStreaming, Executor> : public detail::ClientRP
     auto finish(CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientFinishWritableStreamSenderInitiation{},
+            this->grpc_context(), this->operation_slot(), detail::ClientFinishWritableStreamSenderInitiation{},
             detail::ClientFinishWritableStreamSenderImplementation<Responder>{*this},
             static_cast<CompletionToken&&>(token));
     }
@@ -627,7 +630,8 @@ template <class StubT, class RequestT, class ResponseT, template <class> class R
               PrepareAsyncServerStreaming,
           class Executor>
 class ClientRPCServerStreamingBase<PrepareAsyncServerStreaming, Executor>
-    : public detail::ClientRPCBase<ResponderT<ResponseT>, Executor>
+    : public detail::ClientRPCBase<ResponderT<ResponseT>, Executor>,
+      private detail::RPCOperationSlot
 {
   private:
     using Responder = ResponderT<ResponseT>;
@@ -736,8 +740,9 @@ class ClientRPCServerStreamingBase<PrepareAsyncServerStreaming, Executor>
     auto read(ResponseT& response, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientReadSenderInitiation<Responder>{*this, response},
-            detail::ClientReadSenderImplementation{}, static_cast<CompletionToken&&>(token));
+            this->grpc_context(), this->operation_slot(),
+            detail::ClientReadSenderInitiation<Responder>{*this, response}, detail::ClientReadSenderImplementation{},
+            static_cast<CompletionToken&&>(token));
     }
 
     /**
@@ -772,7 +777,7 @@ class ClientRPCServerStreamingBase<PrepareAsyncServerStreaming, Executor>
     auto finish(CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientFinishServerStreamingSenderInitation{},
+            this->grpc_context(), this->operation_slot(), detail::ClientFinishServerStreamingSenderInitation{},
             detail::ClientFinishReadableStreamSenderImplementation<Responder>{*this},
             static_cast<CompletionToken&&>(token));
     }
@@ -832,7 +837,8 @@ namespace detail
  */
 template <class RequestT, class ResponseT, template <class, class> class ResponderT, class Executor>
 class ClientRPCBidiStreamingBase<ResponderT<RequestT, ResponseT>, Executor>
-    : public detail::ClientRPCBase<ResponderT<RequestT, ResponseT>, Executor>
+    : public detail::ClientRPCBase<ResponderT<RequestT, ResponseT>, Executor>,
+      private detail::BidiRPCOperationSlots
 {
   private:
     using Responder = ResponderT<RequestT, ResponseT>;
@@ -893,7 +899,7 @@ class ClientRPCBidiStreamingBase<ResponderT<RequestT, ResponseT>, Executor>
     auto read(ResponseT& response, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientReadSenderInitiation<Responder>{*this, response},
+            this->grpc_context(), this->read_slot(), detail::ClientReadSenderInitiation<Responder>{*this, response},
             detail::ClientReadSenderImplementation{}, static_cast<CompletionToken&&>(token));
     }
 
@@ -914,7 +920,7 @@ class ClientRPCBidiStreamingBase<ResponderT<RequestT, ResponseT>, Executor>
     auto write(const RequestT& request, grpc::WriteOptions options, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientWriteSenderInitiation<RequestT>{request, options},
+            this->grpc_context(), this->write_slot(), detail::ClientWriteSenderInitiation<RequestT>{request, options},
             detail::ClientWriteSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -947,7 +953,7 @@ class ClientRPCBidiStreamingBase<ResponderT<RequestT, ResponseT>, Executor>
     auto writes_done(CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientWritesDoneSenderInitiation{},
+            this->grpc_context(), this->write_slot(), detail::ClientWritesDoneSenderInitiation{},
             detail::ClientWritesDoneSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -983,7 +989,7 @@ class ClientRPCBidiStreamingBase<ResponderT<RequestT, ResponseT>, Executor>
     auto finish(CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ClientFinishWritableStreamSenderInitiation{},
+            this->grpc_context(), this->write_slot(), detail::ClientFinishWritableStreamSenderInitiation{},
             detail::ClientFinishWritableStreamSenderImplementation<Responder>{*this},
             static_cast<CompletionToken&&>(token));
     }
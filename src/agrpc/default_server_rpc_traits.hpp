@@ -15,10 +15,35 @@
 #ifndef AGRPC_AGRPC_DEFAULT_SERVER_RPC_TRAITS_HPP
 #define AGRPC_AGRPC_DEFAULT_SERVER_RPC_TRAITS_HPP
 
+#include <chrono>
+#include <cstddef>
+
 #include <agrpc/detail/config.hpp>
 
 AGRPC_NAMESPACE_BEGIN()
 
+/**
+ * @brief (experimental) What `register_*_rpc_handler` does when `MAX_IN_FLIGHT_RPCS` has been reached
+ *
+ * @since 3.8.0
+ */
+enum class InFlightLimitPolicy
+{
+    /**
+     * @brief Stop requesting new calls until an rpc finishes
+     *
+     * Incoming calls wait in gRPC's queue of unmatched calls, no memory is spent on them by the handler.
+     */
+    PAUSE_ACCEPTING,
+
+    /**
+     * @brief Accept calls and immediately finish them with `grpc::StatusCode::RESOURCE_EXHAUSTED`
+     *
+     * Clients learn about the overload right away and can retry elsewhere, instead of waiting for their deadline.
+     */
+    REJECT
+};
+
 /**
  * @brief Default ServerRPC traits
  *
@@ -43,6 +68,81 @@ struct DefaultServerRPCTraits
      * @brief Whether the ServerRPC should support `wait_for_done`
      */
     static constexpr bool NOTIFY_WHEN_DONE = false;
+
+    /**
+     * @brief (experimental) Number of requests that `register_*_rpc_handler` keeps outstanding
+     *
+     * By default, the next request is only started after the previous one has been accepted, which means that a burst
+     * of incoming calls is accepted one completion queue round-trip at a time. Larger values allow multiple calls to be
+     * accepted at once. Must be greater than zero.
+     *
+     * @since 3.8.0
+     */
+    static constexpr std::size_t ACCEPT_BACKLOG = 1;
+
+    /**
+     * @brief (experimental) Number of finished rpcs that `register_callback_rpc_handler` keeps for reuse
+     *
+     * Instead of freeing the memory of a finished rpc it is kept and reused for one of the next rpcs. If the request
+     * message is created by the library and has a `Clear()` method, like protobuf messages and `grpc::ByteBuffer`, then
+     * it is kept alive as well and cleared before reuse, which preserves its internal buffers. The limit applies to
+     * each call of `register_callback_rpc_handler`. The kept memory is only freed when the handler is done. Zero
+     * disables the reuse.
+     *
+     * Example showing how to enable the reuse:
+     *
+     * @code{cpp}
+     * struct MyTraits : agrpc::DefaultServerRPCTraits
+     * {
+     *     static constexpr std::size_t ALLOCATION_CACHE_SIZE = 16;
+     * };
+     * @endcode
+     *
+     * @since 3.8.0
+     */
+    static constexpr std::size_t ALLOCATION_CACHE_SIZE = 0;
+
+    /**
+     * @brief (experimental) Maximum number of rpcs that `register_*_rpc_handler` runs concurrently
+     *
+     * An rpc is in-flight from the moment its request has been accepted until it is destroyed. Once the limit has been
+     * reached, `IN_FLIGHT_LIMIT_POLICY` decides what happens to further calls. The limit applies to each call of
+     * `register_*_rpc_handler` and must not be smaller than `ACCEPT_BACKLOG`. Zero means no limit.
+     *
+     * @since 3.8.0
+     */
+    static constexpr std::size_t MAX_IN_FLIGHT_RPCS = 0;
+
+    /**
+     * @brief (experimental) What to do with calls that exceed `MAX_IN_FLIGHT_RPCS`
+     *
+     * @since 3.8.0
+     */
+    static constexpr agrpc::InFlightLimitPolicy IN_FLIGHT_LIMIT_POLICY = agrpc::InFlightLimitPolicy::PAUSE_ACCEPTING;
+
+    /**
+     * @brief (experimental) Queue delay above which `register_*_rpc_handler` starts to shed load
+     *
+     * The queue delay of an rpc is the time that the completion of its request may have spent in the
+     * `grpc::CompletionQueue` before the GrpcContext picked it up, measured from the last time that the GrpcContext
+     * found the queue empty. It grows when the GrpcContext cannot keep up with the load.
+     *
+     * Load is shed in the style of CoDel: if even the smallest queue delay during one `QUEUE_DELAY_INTERVAL` exceeded
+     * the target, then during the next interval rpcs whose queue delay exceeds twice the target are finished with
+     * `grpc::StatusCode::RESOURCE_EXHAUSTED` without invoking the rpc handler. Short bursts do not cause load to be
+     * shed. The measured queue delays are recorded, see `GrpcContext::queue_delay_statistics()`. Zero disables load
+     * shedding.
+     *
+     * @since 3.8.0
+     */
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_TARGET{};
+
+    /**
+     * @brief (experimental) Interval over which the smallest queue delay is compared to `QUEUE_DELAY_TARGET`
+     *
+     * @since 3.8.0
+     */
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_INTERVAL = std::chrono::milliseconds(100);
 };
 
 AGRPC_NAMESPACE_END
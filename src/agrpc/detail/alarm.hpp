@@ -16,9 +16,12 @@
 #define AGRPC_DETAIL_ALARM_HPP
 
 #include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/grpc_context_implementation.hpp>
 #include <agrpc/detail/grpc_sender.hpp>
 #include <agrpc/detail/movable_atomic.hpp>
 #include <agrpc/detail/sender_implementation.hpp>
+#include <agrpc/detail/timer_wheel.hpp>
+#include <grpcpp/alarm.h>
 
 #include <agrpc/detail/asio_macros.hpp>
 #include <agrpc/detail/config.hpp>
@@ -31,28 +34,38 @@ template <class Deadline>
 struct AlarmInitFunction
 {
     grpc::Alarm& alarm_;
+    detail::AlarmTimerWheelHandle& timer_wheel_handle_;
     Deadline deadline_;
 
     void operator()(agrpc::GrpcContext& grpc_context, void* tag) const
     {
-        alarm_.Set(grpc_context.get_completion_queue(), deadline_, tag);
+        if (!GrpcContextImplementation::is_alarm_timer_wheel_enabled(grpc_context) ||
+            !GrpcContextImplementation::add_alarm(grpc_context, timer_wheel_handle_,
+                                                  grpc::TimePoint<Deadline>(deadline_).raw_time(), tag))
+        {
+            alarm_.Set(grpc_context.get_completion_queue(), deadline_, tag);
+        }
     }
 };
 
 template <class Deadline>
-AlarmInitFunction(grpc::Alarm&, const Deadline&) -> AlarmInitFunction<Deadline>;
+AlarmInitFunction(grpc::Alarm&, detail::AlarmTimerWheelHandle&, const Deadline&) -> AlarmInitFunction<Deadline>;
 
-struct AlarmCancellationFunction
+inline void cancel_alarm(grpc::Alarm& alarm, const detail::AlarmTimerWheelHandle& timer_wheel_handle)
 {
-    explicit AlarmCancellationFunction(grpc::Alarm& alarm) noexcept : alarm_(alarm) {}
+    alarm.Cancel();
+    GrpcContextImplementation::cancel_alarm(timer_wheel_handle);
+}
 
+struct AlarmCancellationFunction
+{
     template <class Deadline>
     explicit AlarmCancellationFunction(const detail::AlarmInitFunction<Deadline>& init_function) noexcept
-        : alarm_(init_function.alarm_)
+        : alarm_(init_function.alarm_), timer_wheel_handle_(init_function.timer_wheel_handle_)
     {
     }
 
-    void operator()() const { alarm_.Cancel(); }
+    void operator()() const { detail::cancel_alarm(alarm_, timer_wheel_handle_); }
 
 #ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
     void operator()(asio::cancellation_type type) const
@@ -65,6 +78,7 @@ struct AlarmCancellationFunction
 #endif
 
     grpc::Alarm& alarm_;
+    const detail::AlarmTimerWheelHandle& timer_wheel_handle_;
 };
 
 template <class Executor>
@@ -89,6 +103,8 @@ struct MoveAlarmSenderImplementation
 
     auto& grpc_alarm() { return alarm_.alarm_; }
 
+    auto& timer_wheel_handle() { return alarm_.timer_wheel_handle_; }
+
     agrpc::BasicAlarm<Executor> alarm_;
     MovableAtomic<bool> done_{};
 };
@@ -153,7 +169,7 @@ struct MoveAlarmSenderInitiation
     template <class Executor>
     void initiate(agrpc::GrpcContext& grpc_context, MoveAlarmSenderImplementation<Executor>& impl, void* tag) const
     {
-        detail::AlarmInitFunction{impl.grpc_alarm(), deadline_}(grpc_context, tag);
+        detail::AlarmInitFunction{impl.grpc_alarm(), impl.timer_wheel_handle(), deadline_}(grpc_context, tag);
     }
 
     Deadline deadline_;
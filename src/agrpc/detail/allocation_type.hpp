@@ -25,7 +25,8 @@ enum class AllocationType
 {
     NONE,
     LOCAL,
-    CUSTOM
+    CUSTOM,
+    SLOT
 };
 }
 
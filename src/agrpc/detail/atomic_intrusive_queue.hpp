@@ -89,6 +89,40 @@ class AtomicIntrusiveQueue
         return old_value == inactive;
     }
 
+    // Not valid to call if the producer is already marked as inactive.
+    // Leaves the queue in the active state.
+    void dequeue_all(detail::IntrusiveQueue<Item>& output) noexcept
+    {
+        if (head_.load(std::memory_order_relaxed) == nullptr)
+        {
+            return;
+        }
+        void* const old_value = head_.exchange(nullptr, std::memory_order_acquire);
+        output.append(detail::IntrusiveQueue<Item>::make_reversed(static_cast<Item*>(old_value)));
+    }
+
+    // Sequentially consistent so that it cannot be reordered before a preceding
+    // store to another atomic.
+    [[nodiscard]] bool is_marked_inactive() const noexcept
+    {
+        return head_.load(std::memory_order_seq_cst) == producer_inactive_value();
+    }
+
+    // Returns true if the queue was empty and has been marked as inactive.
+    // Not valid to call if the producer is already marked as inactive.
+    //
+    // Sequentially consistent so that a subsequent empty() on another queue
+    // cannot be reordered before it.
+    [[nodiscard]] bool try_mark_inactive() noexcept
+    {
+        void* expect_empty = nullptr;
+        return head_.compare_exchange_strong(expect_empty, producer_inactive_value(), std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+    }
+
+    // Only valid to call on a queue that is never marked as inactive.
+    [[nodiscard]] bool empty() const noexcept { return head_.load(std::memory_order_seq_cst) == nullptr; }
+
     // Not valid to call if the producer is already marked as inactive.
     [[nodiscard]] bool dequeue_all_and_try_mark_inactive(detail::IntrusiveQueue<Item>& output) noexcept
     {
@@ -96,7 +130,7 @@ class AtomicIntrusiveQueue
         void* const inactive = producer_inactive_value();
         void* expect_empty = nullptr;
         const bool marked_inactive =
-            head_.compare_exchange_strong(expect_empty, inactive, std::memory_order_release, std::memory_order_relaxed);
+            head_.compare_exchange_strong(expect_empty, inactive, std::memory_order_seq_cst, std::memory_order_relaxed);
         output.append(detail::IntrusiveQueue<Item>::make_reversed(static_cast<Item*>(old_value)));
         return marked_inactive;
     }
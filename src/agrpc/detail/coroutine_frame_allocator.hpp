@@ -0,0 +1,107 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_COROUTINE_FRAME_ALLOCATOR_HPP
+#define AGRPC_DETAIL_COROUTINE_FRAME_ALLOCATOR_HPP
+
+#include <agrpc/detail/memory.hpp>
+#include <agrpc/detail/pool_resource.hpp>
+
+#include <cstddef>
+#include <new>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// Frames of size classes that are not pooled by a GrpcContext, e.g. because the frame was allocated by a thread that
+// does not run one, like the threads that gRPC invokes callback reactors on. Keeps a few frames per size class.
+class CoroutineFrameCache
+{
+  public:
+    static constexpr std::size_t FRAMES_PER_SIZE_CLASS = 4;
+
+    CoroutineFrameCache() = default;
+
+    CoroutineFrameCache(const CoroutineFrameCache&) = delete;
+    CoroutineFrameCache(CoroutineFrameCache&&) = delete;
+    CoroutineFrameCache& operator=(const CoroutineFrameCache&) = delete;
+    CoroutineFrameCache& operator=(CoroutineFrameCache&&) = delete;
+
+    ~CoroutineFrameCache() noexcept
+    {
+        for (std::size_t i{}; i != POOL_COUNT; ++i)
+        {
+            auto& size_class = size_classes_[i];
+            while (size_class.size_ != 0)
+            {
+                detail::Pool::deallocate_unmanaged_block(size_class.frames_[--size_class.size_],
+                                                         detail::get_block_size_of_pool_at(i));
+            }
+        }
+    }
+
+    [[nodiscard]] void* pop(std::size_t pool_index) noexcept
+    {
+        auto& size_class = size_classes_[pool_index];
+        if (size_class.size_ == 0)
+        {
+            return nullptr;
+        }
+        return size_class.frames_[--size_class.size_];
+    }
+
+    // Returns false if the size class is full
+    [[nodiscard]] bool push(void* frame, std::size_t pool_index) noexcept
+    {
+        auto& size_class = size_classes_[pool_index];
+        if (size_class.size_ == FRAMES_PER_SIZE_CLASS)
+        {
+            return false;
+        }
+        size_class.frames_[size_class.size_++] = frame;
+        return true;
+    }
+
+  private:
+    struct SizeClass
+    {
+        std::size_t size_{};
+        void* frames_[FRAMES_PER_SIZE_CLASS];
+    };
+
+    SizeClass size_classes_[POOL_COUNT]{};
+};
+
+inline thread_local detail::CoroutineFrameCache thread_local_coroutine_frame_cache{};
+
+// The size of the allocation is stored in front of the frame because it is not known when the frame is deallocated
+// through means other than the frame's `operator delete`, e.g. by a reactor whose reference count dropped to zero.
+struct CoroutineFrameHeader
+{
+    std::size_t size_;
+};
+
+inline constexpr std::size_t COROUTINE_FRAME_HEADER_SIZE = detail::align(sizeof(CoroutineFrameHeader), MAX_ALIGN);
+
+[[nodiscard]] void* allocate_coroutine_frame(std::size_t frame_size);
+
+void deallocate_coroutine_frame(void* frame) noexcept;
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_COROUTINE_FRAME_ALLOCATOR_HPP
@@ -26,7 +26,7 @@ AGRPC_NAMESPACE_BEGIN()
 
 namespace detail
 {
-template <bool IsBlockingNever, class Handler>
+template <bool IsBlockingNever, bool IsHighPriority = false, class Handler>
 void create_and_submit_no_arg_operation(agrpc::GrpcContext& grpc_context, Handler&& handler)
 {
     if AGRPC_UNLIKELY (detail::GrpcContextImplementation::is_shutdown(grpc_context))
@@ -44,14 +44,29 @@ void create_and_submit_no_arg_operation(agrpc::GrpcContext& grpc_context, Handle
         }
     }
     auto operation = detail::allocate_operation<detail::NoArgOperation>(grpc_context, static_cast<Handler&&>(handler));
-    GrpcContextImplementation::work_started(grpc_context);
     if (is_running_in_this_thread)
     {
-        detail::GrpcContextImplementation::add_local_operation(operation);
+        detail::GrpcContextImplementation::work_started_in_this_thread(grpc_context);
+        if constexpr (IsHighPriority)
+        {
+            detail::GrpcContextImplementation::add_local_high_priority_operation(operation);
+        }
+        else
+        {
+            detail::GrpcContextImplementation::add_local_operation(operation);
+        }
     }
     else
     {
-        detail::GrpcContextImplementation::add_remote_operation(grpc_context, operation);
+        detail::GrpcContextImplementation::work_started(grpc_context);
+        if constexpr (IsHighPriority)
+        {
+            detail::GrpcContextImplementation::add_remote_high_priority_operation(grpc_context, operation);
+        }
+        else
+        {
+            detail::GrpcContextImplementation::add_remote_operation(grpc_context, operation);
+        }
     }
 }
 }
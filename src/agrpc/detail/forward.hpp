@@ -17,6 +17,7 @@
 
 #include <agrpc/detail/grpc_executor_options.hpp>
 
+#include <cstddef>
 #include <memory>
 
 #include <agrpc/detail/config.hpp>
@@ -78,6 +79,9 @@ class ServerRPC;
 template <class ServerRPCT>
 class ServerRPCPtr;
 
+template <class T = void, class Executor = agrpc::BasicGrpcExecutor<>>
+class Task;
+
 template <class Signature, class Executor = agrpc::BasicGrpcExecutor<>>
 class Waiter;
 
@@ -108,6 +112,12 @@ class BasicClientBidiReactor;
 template <class Reactor>
 class ReactorPtr;
 
+template <class T>
+class RPCArenaAllocator;
+
+template <std::size_t InlineSize>
+class BasicRPCArena;
+
 namespace detail
 {
 template <class Item>
@@ -199,6 +209,8 @@ class RefCountedClientReactor;
 
 template <class Reactor>
 class ServerReactorPromiseType;
+
+struct GrpcContextPoolStealer;
 }
 
 AGRPC_NAMESPACE_END
@@ -24,6 +24,10 @@
 #include <grpcpp/completion_queue.h>
 
 #include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include <agrpc/detail/config.hpp>
 
@@ -60,22 +64,20 @@ struct GrpcContextCompletionQueueLoopCondition : Function
 template <class Function>
 GrpcContextCompletionQueueLoopCondition(Function) -> GrpcContextCompletionQueueLoopCondition<Function>;
 
-template <class T>
-inline void create_resources(T& resources, std::size_t concurrency_hint)
+inline void create_resources(detail::ListablePoolResource*& created_resources, std::size_t concurrency_hint,
+                             const std::atomic_size_t& largest_pooled_block_size)
 {
     for (size_t i{}; i != concurrency_hint; ++i)
     {
-        auto resource = new detail::ListablePoolResource();
-        resources.push_front(*resource);
+        detail::create_resource(created_resources, largest_pooled_block_size);
     }
 }
 
-template <class T>
-inline void delete_resources(T& resources)
+inline void delete_resources(detail::ListablePoolResource* created_resources) noexcept
 {
-    while (!resources.empty())
+    while (created_resources != nullptr)
     {
-        delete &resources.pop_front();
+        delete std::exchange(created_resources, created_resources->next_created_);
     }
 }
 }  // namespace detail
@@ -101,31 +103,35 @@ inline GrpcContext::GrpcContext(std::unique_ptr<grpc::ServerCompletionQueue> com
 inline GrpcContext::GrpcContext(std::unique_ptr<grpc::ServerCompletionQueue> completion_queue,
                                 std::size_t concurrency_hint)
     : multithreaded_{concurrency_hint > 1},
+      concurrency_hint_{concurrency_hint},
       completion_queue_(static_cast<std::unique_ptr<grpc::ServerCompletionQueue>&&>(completion_queue))
 
 {
-    detail::create_resources(memory_resources_, concurrency_hint);
+    detail::create_resources(created_memory_resources_, concurrency_hint, largest_pooled_block_size_);
 }
 
 inline GrpcContext::GrpcContext(std::unique_ptr<grpc::CompletionQueue> completion_queue, std::size_t concurrency_hint)
     : multithreaded_{concurrency_hint > 1},
+      concurrency_hint_{concurrency_hint},
       completion_queue_(static_cast<std::unique_ptr<grpc::CompletionQueue>&&>(completion_queue))
 
 {
-    detail::create_resources(memory_resources_, concurrency_hint);
+    detail::create_resources(created_memory_resources_, concurrency_hint, largest_pooled_block_size_);
 }
 
 inline GrpcContext::~GrpcContext()
 {
     stop();
     shutdown_ = true;
+    detail::GrpcContextImplementation::shutdown_alarm_timer_wheel(*this);
     completion_queue_->Shutdown();
     detail::GrpcContextImplementation::drain_completion_queue(*this);
 #if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
     asio::execution_context::shutdown();
     asio::execution_context::destroy();
 #endif
-    detail::delete_resources(memory_resources_);
+    detail::delete_resources(created_memory_resources_);
+    delete alarm_timer_wheel_.load(std::memory_order_relaxed);
 }
 
 inline bool GrpcContext::run()
@@ -203,6 +209,120 @@ inline void GrpcContext::work_finished() noexcept
     }
 }
 
+inline void GrpcContext::set_busy_poll_duration(std::chrono::nanoseconds duration) noexcept
+{
+    busy_poll_duration_.store(duration.count(), std::memory_order_relaxed);
+}
+
+inline std::chrono::nanoseconds GrpcContext::busy_poll_duration() const noexcept
+{
+    return std::chrono::nanoseconds{busy_poll_duration_.load(std::memory_order_relaxed)};
+}
+
+inline void GrpcContext::set_completion_queue_batch_size(std::size_t batch_size) noexcept
+{
+    completion_queue_batch_size_.store(batch_size, std::memory_order_relaxed);
+}
+
+inline std::size_t GrpcContext::completion_queue_batch_size() const noexcept
+{
+    return completion_queue_batch_size_.load(std::memory_order_relaxed);
+}
+
+inline void GrpcContext::set_local_work_budget(std::size_t budget) noexcept
+{
+    local_work_budget_.store(budget, std::memory_order_relaxed);
+}
+
+inline std::size_t GrpcContext::local_work_budget() const noexcept
+{
+    return local_work_budget_.load(std::memory_order_relaxed);
+}
+
+inline void GrpcContext::set_alarm_resolution(std::chrono::nanoseconds resolution)
+{
+    if (resolution.count() > 0 && alarm_timer_wheel_.load(std::memory_order_acquire) == nullptr)
+    {
+        auto timer_wheel = std::make_unique<detail::AlarmTimerWheel>();
+        detail::AlarmTimerWheel* expected{};
+        if (alarm_timer_wheel_.compare_exchange_strong(expected, timer_wheel.get(), std::memory_order_release,
+                                                       std::memory_order_relaxed))
+        {
+            (void)timer_wheel.release();
+        }
+    }
+    alarm_resolution_.store(resolution.count(), std::memory_order_relaxed);
+}
+
+inline std::chrono::nanoseconds GrpcContext::alarm_resolution() const noexcept
+{
+    return std::chrono::nanoseconds{alarm_resolution_.load(std::memory_order_relaxed)};
+}
+
+inline GrpcContext::BusyPollStatistics GrpcContext::busy_poll_statistics() const noexcept
+{
+    return {std::chrono::nanoseconds{busy_poll_counters_.spin_duration_.load(std::memory_order_relaxed)},
+            std::chrono::nanoseconds{busy_poll_counters_.sleep_duration_.load(std::memory_order_relaxed)},
+            busy_poll_counters_.spin_events_.load(std::memory_order_relaxed),
+            busy_poll_counters_.sleep_events_.load(std::memory_order_relaxed)};
+}
+
+inline GrpcContext::QueueDelayStatistics GrpcContext::queue_delay_statistics() const noexcept
+{
+    return {std::chrono::nanoseconds{queue_delay_counters_.total_delay_.load(std::memory_order_relaxed)},
+            std::chrono::nanoseconds{queue_delay_counters_.max_delay_.load(std::memory_order_relaxed)},
+            queue_delay_counters_.rpcs_.load(std::memory_order_relaxed),
+            queue_delay_counters_.rejected_rpcs_.load(std::memory_order_relaxed)};
+}
+
+inline std::vector<GrpcContext::MemoryResourceStatistics> GrpcContext::memory_resource_statistics() const
+{
+    std::vector<MemoryResourceStatistics> result;
+    std::lock_guard guard{memory_resources_mutex_};
+    for (auto* resource = created_memory_resources_; resource != nullptr; resource = resource->next_created_)
+    {
+        const auto statistics = resource->resource_.statistics();
+        auto& entry = result.emplace_back();
+        entry.local_deallocations = statistics.local_deallocations;
+        entry.remote_deallocations = statistics.remote_deallocations;
+        entry.remote_frees = statistics.remote_frees;
+        entry.reserved_bytes = {};
+        entry.used_bytes = {};
+        for (const auto& pool : statistics.pools)
+        {
+            entry.reserved_bytes += pool.reserved_bytes;
+            entry.used_bytes += pool.used_bytes;
+            entry.size_classes.push_back({pool.block_size, pool.reserved_bytes, pool.used_bytes});
+        }
+    }
+    return result;
+}
+
+inline void GrpcContext::set_max_pooled_allocation_size(std::size_t size) noexcept
+{
+    largest_pooled_block_size_.store(detail::round_to_pool_block_size(size), std::memory_order_relaxed);
+}
+
+inline std::size_t GrpcContext::max_pooled_allocation_size() const noexcept
+{
+    return largest_pooled_block_size_.load(std::memory_order_relaxed);
+}
+
+inline void GrpcContext::trim_memory_resources()
+{
+    const auto epoch = memory_resources_trim_epoch_.fetch_add(1, std::memory_order_relaxed) + 1;
+    std::lock_guard guard{memory_resources_mutex_};
+    for (auto* resource = created_memory_resources_; resource != nullptr; resource = resource->next_created_)
+    {
+        // Resources that are in use are trimmed by their thread, see trim_memory_resource_if_requested()
+        if (detail::try_acquire_resource(*resource))
+        {
+            detail::GrpcContextImplementation::trim_memory_resource(*resource, epoch);
+            detail::release_resource(*resource);
+        }
+    }
+}
+
 inline grpc::CompletionQueue* GrpcContext::get_completion_queue() noexcept { return completion_queue_.get(); }
 
 inline grpc::ServerCompletionQueue* GrpcContext::get_server_completion_queue() noexcept
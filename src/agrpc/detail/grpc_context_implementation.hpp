@@ -22,11 +22,15 @@
 #include <agrpc/detail/listable_pool_resource.hpp>
 #include <agrpc/detail/operation_base.hpp>
 #include <agrpc/detail/pool_resource.hpp>
+#include <agrpc/detail/timer_wheel.hpp>
 #include <agrpc/detail/utility.hpp>
 #include <grpcpp/completion_queue.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 
 #include <agrpc/detail/config.hpp>
 
@@ -34,17 +38,66 @@ AGRPC_NAMESPACE_BEGIN()
 
 namespace detail
 {
+struct GrpcContextThreadContext;
+
+// Marks the completion of one unit of work when a completion handler exits. While the handler runs, work that it
+// starts on this thread is counted in the thread context without atomic operations. That count is merged into the
+// GrpcContext's atomic counter on exit.
 struct WorkFinishedOnExitFunctor
 {
     agrpc::GrpcContext& grpc_context_;
+    detail::GrpcContextThreadContext* context_;
+    bool was_counting_private_work_{};
+
+    explicit WorkFinishedOnExitFunctor(agrpc::GrpcContext& grpc_context) noexcept;
 
-    explicit WorkFinishedOnExitFunctor(agrpc::GrpcContext& grpc_context) noexcept : grpc_context_(grpc_context) {}
+    explicit WorkFinishedOnExitFunctor(detail::GrpcContextThreadContext& context) noexcept;
 
     void operator()() const noexcept;
 };
 
 using WorkFinishedOnExit = detail::ScopeGuard<detail::WorkFinishedOnExitFunctor>;
 
+struct BusyPollCounters
+{
+    std::atomic<std::chrono::nanoseconds::rep> spin_duration_{};
+    std::atomic<std::chrono::nanoseconds::rep> sleep_duration_{};
+    std::atomic<std::uint64_t> spin_events_{};
+    std::atomic<std::uint64_t> sleep_events_{};
+};
+
+struct QueueDelayCounters
+{
+    // Number of registered rpc handlers that measure the queue delay
+    std::atomic_size_t trackers_{};
+    // Completions that are in the queue have arrived after this point in time
+    std::atomic<std::chrono::nanoseconds::rep> empty_time_{};
+    std::atomic<std::chrono::nanoseconds::rep> total_delay_{};
+    std::atomic<std::chrono::nanoseconds::rep> max_delay_{};
+    std::atomic<std::uint64_t> rpcs_{};
+    std::atomic<std::uint64_t> rejected_rpcs_{};
+};
+
+// Lets idle GrpcContexts execute the queued work of a busy one, see GrpcContextPool. The busy GrpcContext moves all but
+// its next local operation into shared_work_ and submits this operation to the GrpcContext returned by find_thief_, if
+// any. An idle GrpcContext calls steal_ before it waits for the completion queue.
+struct WorkStealingHook : detail::QueueableOperationBase
+{
+    using FindThief = agrpc::GrpcContext* (*)(detail::WorkStealingHook&) noexcept;
+    using Steal = bool (*)(detail::WorkStealingHook&);
+
+    WorkStealingHook(detail::OperationOnComplete on_steal, FindThief find_thief, Steal steal) noexcept
+        : detail::QueueableOperationBase(on_steal), find_thief_(find_thief), steal_(steal)
+    {
+    }
+
+    FindThief find_thief_;
+    Steal steal_;
+    std::atomic_bool has_shared_work_{};
+    std::mutex shared_work_mutex_;
+    detail::IntrusiveQueue<detail::QueueableOperationBase> shared_work_;
+};
+
 struct GrpcContextThreadContext
 #if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
     // Enables Boost.Asio's awaitable frame memory recycling
@@ -54,8 +107,16 @@ struct GrpcContextThreadContext
     explicit GrpcContextThreadContext(agrpc::GrpcContext& grpc_context, bool multithreaded);
 
     bool check_remote_work_;
+    bool is_counting_private_work_{};
+    // In multithreaded mode, each thread context acts as a shard of the GrpcContext's outstanding work counter.
+    // Finished work is only subtracted from the shared counter before the thread goes idle, because only then can the
+    // counter reach zero.
+    const bool is_deferring_finished_work_;
+    long private_outstanding_work_{};
+    long finished_outstanding_work_{};
     agrpc::GrpcContext& grpc_context_;
     detail::IntrusiveQueue<detail::QueueableOperationBase> local_work_queue_;
+    detail::IntrusiveQueue<detail::QueueableOperationBase> local_high_priority_work_queue_;
     GrpcContextThreadContext* old_context_;
     detail::ListablePoolResource& resource_;
 
@@ -129,12 +190,54 @@ struct GrpcContextImplementation
 
     static void work_started(agrpc::GrpcContext& grpc_context) noexcept;
 
+    static void work_started(agrpc::GrpcContext& grpc_context, long count) noexcept;
+
+    static void work_started_in_this_thread(agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void work_finished(agrpc::GrpcContext& grpc_context, long count) noexcept;
+
+    static void merge_outstanding_work(detail::GrpcContextThreadContext& context, long work_delta) noexcept;
+
+    static void flush_finished_outstanding_work(detail::GrpcContextThreadContext& context) noexcept;
+
     static void add_remote_operation(agrpc::GrpcContext& grpc_context, detail::QueueableOperationBase* op) noexcept;
 
     static void add_local_operation(detail::QueueableOperationBase* op) noexcept;
 
     static void add_operation(agrpc::GrpcContext& grpc_context, detail::QueueableOperationBase* op) noexcept;
 
+    static void add_remote_high_priority_operation(agrpc::GrpcContext& grpc_context,
+                                                   detail::QueueableOperationBase* op) noexcept;
+
+    static void add_local_high_priority_operation(detail::QueueableOperationBase* op) noexcept;
+
+    [[nodiscard]] static bool mark_remote_work_active_for_high_priority_work(agrpc::GrpcContext& grpc_context) noexcept;
+
+    [[nodiscard]] static bool get_next_event(agrpc::GrpcContext& grpc_context, detail::GrpcCompletionQueueEvent& event,
+                                             ::gpr_timespec deadline, detail::InvokeHandler invoke) noexcept;
+
+    [[nodiscard]] static bool wait_for_next_event(agrpc::GrpcContext& grpc_context,
+                                                  detail::GrpcCompletionQueueEvent& event,
+                                                  ::gpr_timespec deadline) noexcept;
+
+    [[nodiscard]] static bool busy_poll_next_event(agrpc::GrpcContext& grpc_context,
+                                                   detail::GrpcCompletionQueueEvent& event, ::gpr_timespec deadline,
+                                                   std::chrono::nanoseconds busy_poll_duration) noexcept;
+
+    [[nodiscard]] static bool is_tracking_queue_delay(const agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void mark_completion_queue_empty(agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void start_tracking_queue_delay(agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void stop_tracking_queue_delay(agrpc::GrpcContext& grpc_context) noexcept;
+
+    [[nodiscard]] static std::chrono::nanoseconds queue_delay(const agrpc::GrpcContext& grpc_context,
+                                                              std::chrono::steady_clock::time_point now) noexcept;
+
+    static void record_queue_delay(agrpc::GrpcContext& grpc_context, std::chrono::nanoseconds delay,
+                                   bool rejected) noexcept;
+
     static CompletionQueueEventResult do_one_completion_queue_event(
         detail::GrpcContextThreadContext& context, ::gpr_timespec deadline,
         detail::InvokeHandler invoke = detail::InvokeHandler::YES_);
@@ -143,11 +246,30 @@ struct GrpcContextImplementation
 
     [[nodiscard]] static bool move_local_queue_to_remote_work(detail::GrpcContextThreadContext& context) noexcept;
 
+    [[nodiscard]] static bool move_local_high_priority_queue_to_remote_work(
+        detail::GrpcContextThreadContext& context) noexcept;
+
     [[nodiscard]] static bool move_remote_work_to_local_queue(detail::GrpcContextThreadContext& context) noexcept;
 
+    static void move_remote_work_to_local_queue_and_keep_active(detail::GrpcContextThreadContext& context) noexcept;
+
+    [[nodiscard]] static bool try_mark_remote_work_inactive(detail::GrpcContextThreadContext& context) noexcept;
+
+    [[nodiscard]] static bool has_idle_threads(const agrpc::GrpcContext& grpc_context) noexcept;
+
     [[nodiscard]] static bool distribute_all_local_work_to_other_threads_but_one(
         detail::GrpcContextThreadContext& context) noexcept;
 
+    static void share_local_work(detail::GrpcContextThreadContext& context);
+
+    static void take_shared_operation(detail::GrpcContextThreadContext& context);
+
+    static void take_back_shared_work(detail::GrpcContextThreadContext& context);
+
+    static bool steal_shared_work(agrpc::GrpcContext& grpc_context);
+
+    static void wake_up_thief(detail::WorkStealingHook& hook) noexcept;
+
     static bool process_local_queue(detail::GrpcContextThreadContext& context, detail::InvokeHandler invoke);
 
     template <bool IsMultithreaded, class LoopCondition>
@@ -160,11 +282,38 @@ struct GrpcContextImplementation
 
     static void drain_completion_queue(agrpc::GrpcContext& grpc_context) noexcept;
 
+    [[nodiscard]] static bool is_alarm_timer_wheel_enabled(const agrpc::GrpcContext& grpc_context) noexcept;
+
+    [[nodiscard]] static bool add_alarm(agrpc::GrpcContext& grpc_context, detail::AlarmTimerWheelHandle& handle,
+                                        ::gpr_timespec deadline, void* tag);
+
+    static void cancel_alarm(const detail::AlarmTimerWheelHandle& handle) noexcept;
+
+    static void release_alarm(detail::AlarmTimerWheelHandle& handle) noexcept;
+
+    static void move_alarm(detail::AlarmTimerWheelHandle& to, detail::AlarmTimerWheelHandle& from) noexcept;
+
+    static void arm_alarm_timer_wheel(agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void process_alarm_timer_wheel(agrpc::GrpcContext& grpc_context, detail::OperationResult result);
+
+    static void shutdown_alarm_timer_wheel(agrpc::GrpcContext& grpc_context) noexcept;
+
     static detail::ListablePoolResource& pop_resource(agrpc::GrpcContext& grpc_context);
 
-    static void push_resource(agrpc::GrpcContext& grpc_context, detail::ListablePoolResource& resource);
+    static void push_resource(agrpc::GrpcContext& grpc_context, detail::ListablePoolResource& resource) noexcept;
+
+    static void trim_memory_resource(detail::ListablePoolResource& resource, std::uint64_t epoch) noexcept;
+
+    static void trim_memory_resource_if_requested(detail::GrpcContextThreadContext& context) noexcept;
 
     static bool is_multithreaded(const agrpc::GrpcContext& grpc_context);
+
+    [[nodiscard]] static long outstanding_work(const agrpc::GrpcContext& grpc_context) noexcept;
+
+    [[nodiscard]] static bool is_waiting_for_remote_work(const agrpc::GrpcContext& grpc_context) noexcept;
+
+    static void set_work_stealing_hook(agrpc::GrpcContext& grpc_context, detail::WorkStealingHook& hook) noexcept;
 };
 
 void process_grpc_tag(void* tag, detail::OperationResult result, agrpc::GrpcContext& grpc_context);
@@ -16,6 +16,7 @@
 #define AGRPC_DETAIL_GRPC_CONTEXT_IMPLEMENTATION_DEFINITION_HPP
 
 #include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/coroutine_frame_allocator.hpp>
 #include <agrpc/detail/grpc_completion_queue_event.hpp>
 #include <agrpc/detail/grpc_context_implementation.hpp>
 #include <agrpc/detail/grpc_context_local_allocator.hpp>
@@ -24,6 +25,10 @@
 #include <grpc/support/time.h>
 #include <grpcpp/completion_queue.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
 #include <agrpc/detail/config.hpp>
 
 AGRPC_NAMESPACE_BEGIN()
@@ -34,8 +39,11 @@ inline thread_local detail::GrpcContextThreadContext* thread_local_grpc_context{
 
 inline GrpcContextThreadContext::GrpcContextThreadContext(agrpc::GrpcContext& grpc_context, bool multithreaded)
     : check_remote_work_{multithreaded ? false : grpc_context.local_check_remote_work_},
+      is_deferring_finished_work_{multithreaded},
       grpc_context_(grpc_context),
       local_work_queue_{multithreaded ? decltype(local_work_queue_){} : std::move(grpc_context.local_work_queue_)},
+      local_high_priority_work_queue_{multithreaded ? decltype(local_high_priority_work_queue_){}
+                                                    : std::move(grpc_context.local_high_priority_work_queue_)},
       old_context_{std::exchange(detail::thread_local_grpc_context, this)},
       resource_{(old_context_ && &old_context_->grpc_context_ == &grpc_context)
                     ? old_context_->resource_
@@ -47,6 +55,10 @@ template <bool IsMultithreaded>
 inline GrpcContextThreadContextImpl<IsMultithreaded>::GrpcContextThreadContextImpl(agrpc::GrpcContext& grpc_context)
     : GrpcContextThreadContext(grpc_context, IsMultithreaded)
 {
+    if constexpr (IsMultithreaded)
+    {
+        grpc_context.busy_thread_count_.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 template <bool IsMultithreaded>
@@ -54,8 +66,12 @@ inline GrpcContextThreadContextImpl<IsMultithreaded>::~GrpcContextThreadContextI
 {
     if constexpr (IsMultithreaded)
     {
+        GrpcContextImplementation::flush_finished_outstanding_work(*this);
+        grpc_context_.busy_thread_count_.fetch_sub(1, std::memory_order_relaxed);
         const bool moved_work = GrpcContextImplementation::move_local_queue_to_remote_work(*this);
-        if (moved_work || check_remote_work_ ||
+        const bool moved_high_priority_work =
+            GrpcContextImplementation::move_local_high_priority_queue_to_remote_work(*this);
+        if (moved_work || moved_high_priority_work || check_remote_work_ ||
             (grpc_context_.is_stopped() && grpc_context_.remote_work_queue_.try_mark_active()))
         {
             GrpcContextImplementation::trigger_work_alarm(grpc_context_);
@@ -63,14 +79,60 @@ inline GrpcContextThreadContextImpl<IsMultithreaded>::~GrpcContextThreadContextI
     }
     else
     {
+        if (check_remote_work_)
+        {
+            // The remote work queue was kept active while this thread had local work. Mark it inactive before leaving
+            // so that remote work and stop() from other threads trigger the work alarm again, e.g. while the next
+            // run_completion_queue() is waiting for the completion queue.
+            while (!GrpcContextImplementation::try_mark_remote_work_inactive(*this))
+            {
+                GrpcContextImplementation::move_remote_work_to_local_queue_and_keep_active(*this);
+            }
+            check_remote_work_ = false;
+        }
         grpc_context_.local_work_queue_ = std::move(local_work_queue_);
+        grpc_context_.local_high_priority_work_queue_ = std::move(local_high_priority_work_queue_);
         grpc_context_.local_check_remote_work_ = check_remote_work_;
     }
-    GrpcContextImplementation::push_resource(grpc_context_, resource_);
+    if (!old_context_ || &old_context_->grpc_context_ != &grpc_context_)
+    {
+        GrpcContextImplementation::push_resource(grpc_context_, resource_);
+    }
     detail::thread_local_grpc_context = old_context_;
 }
 
-inline void WorkFinishedOnExitFunctor::operator()() const noexcept { grpc_context_.work_finished(); }
+inline WorkFinishedOnExitFunctor::WorkFinishedOnExitFunctor(agrpc::GrpcContext& grpc_context) noexcept
+    : grpc_context_(grpc_context), context_(detail::thread_local_grpc_context)
+{
+    if (context_ && &context_->grpc_context_ == &grpc_context)
+    {
+        was_counting_private_work_ = std::exchange(context_->is_counting_private_work_, true);
+    }
+    else
+    {
+        context_ = nullptr;
+    }
+}
+
+inline WorkFinishedOnExitFunctor::WorkFinishedOnExitFunctor(detail::GrpcContextThreadContext& context) noexcept
+    : grpc_context_(context.grpc_context_),
+      context_(&context),
+      was_counting_private_work_(std::exchange(context.is_counting_private_work_, true))
+{
+}
+
+inline void WorkFinishedOnExitFunctor::operator()() const noexcept
+{
+    if (context_)
+    {
+        context_->is_counting_private_work_ = was_counting_private_work_;
+        // One unit of the private work replaces the work of the completion handler that just finished
+        const auto private_work = std::exchange(context_->private_outstanding_work_, 0);
+        GrpcContextImplementation::merge_outstanding_work(*context_, private_work - 1);
+        return;
+    }
+    grpc_context_.work_finished();
+}
 
 inline bool GrpcContextIsNotStopped::operator()() const noexcept { return !grpc_context_.is_stopped(); }
 
@@ -90,6 +152,70 @@ inline void GrpcContextImplementation::work_started(agrpc::GrpcContext& grpc_con
     grpc_context.work_started();
 }
 
+inline void GrpcContextImplementation::work_started(agrpc::GrpcContext& grpc_context, long count) noexcept
+{
+    grpc_context.outstanding_work_.fetch_add(count, std::memory_order_relaxed);
+}
+
+inline void GrpcContextImplementation::work_started_in_this_thread(agrpc::GrpcContext& grpc_context) noexcept
+{
+    // The completion handler that is currently running keeps the outstanding work above zero until its private work
+    // has been merged. Outside of completion handlers, e.g. in agrpc::run, that guarantee does not hold.
+    auto& context = *detail::thread_local_grpc_context;
+    if AGRPC_LIKELY (context.is_counting_private_work_)
+    {
+        ++context.private_outstanding_work_;
+    }
+    else
+    {
+        grpc_context.work_started();
+    }
+}
+
+inline void GrpcContextImplementation::work_finished(agrpc::GrpcContext& grpc_context, long count) noexcept
+{
+    if AGRPC_UNLIKELY (count == grpc_context.outstanding_work_.fetch_sub(count, std::memory_order_relaxed))
+    {
+        grpc_context.stop();
+    }
+}
+
+inline void GrpcContextImplementation::merge_outstanding_work(detail::GrpcContextThreadContext& context,
+                                                              long work_delta) noexcept
+{
+    agrpc::GrpcContext& grpc_context = context.grpc_context_;
+    if (context.is_deferring_finished_work_)
+    {
+        // Started work must be visible to other threads right away, otherwise they could observe the shared counter
+        // reaching zero too early. It is therefore only ever offset against work that has finished on this thread.
+        auto& finished_work = context.finished_outstanding_work_;
+        finished_work -= work_delta;
+        if (finished_work < 0)
+        {
+            GrpcContextImplementation::work_started(grpc_context, -finished_work);
+            finished_work = 0;
+        }
+        return;
+    }
+    if (work_delta > 0)
+    {
+        GrpcContextImplementation::work_started(grpc_context, work_delta);
+    }
+    else if (work_delta < 0)
+    {
+        grpc_context.work_finished();
+    }
+}
+
+inline void GrpcContextImplementation::flush_finished_outstanding_work(
+    detail::GrpcContextThreadContext& context) noexcept
+{
+    if (const auto finished_work = std::exchange(context.finished_outstanding_work_, 0); finished_work != 0)
+    {
+        GrpcContextImplementation::work_finished(context.grpc_context_, finished_work);
+    }
+}
+
 inline void GrpcContextImplementation::add_remote_operation(agrpc::GrpcContext& grpc_context,
                                                             detail::QueueableOperationBase* op) noexcept
 {
@@ -117,6 +243,31 @@ inline void GrpcContextImplementation::add_operation(agrpc::GrpcContext& grpc_co
     }
 }
 
+inline void GrpcContextImplementation::add_remote_high_priority_operation(agrpc::GrpcContext& grpc_context,
+                                                                          detail::QueueableOperationBase* op) noexcept
+{
+    (void)grpc_context.remote_high_priority_work_queue_.enqueue(op);
+    if (GrpcContextImplementation::mark_remote_work_active_for_high_priority_work(grpc_context))
+    {
+        GrpcContextImplementation::trigger_work_alarm(grpc_context);
+    }
+}
+
+inline void GrpcContextImplementation::add_local_high_priority_operation(detail::QueueableOperationBase* op) noexcept
+{
+    detail::thread_local_grpc_context->local_high_priority_work_queue_.push_back(op);
+}
+
+inline bool GrpcContextImplementation::mark_remote_work_active_for_high_priority_work(
+    agrpc::GrpcContext& grpc_context) noexcept
+{
+    // The high priority queue is never marked inactive. Instead, the regular remote work queue tracks whether the
+    // GrpcContext needs to be woken up. The fence pairs with the sequentially consistent marking of the remote work
+    // queue as inactive and the following check of the high priority queue, see try_mark_remote_work_inactive.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return grpc_context.remote_work_queue_.try_mark_active();
+}
+
 inline bool GrpcContextImplementation::running_in_this_thread(const agrpc::GrpcContext& grpc_context) noexcept
 {
     const auto* context = detail::thread_local_grpc_context;
@@ -130,17 +281,63 @@ inline bool GrpcContextImplementation::move_local_queue_to_remote_work(
     return grpc_context.remote_work_queue_.prepend(std::move(context.local_work_queue_));
 }
 
+inline bool GrpcContextImplementation::move_local_high_priority_queue_to_remote_work(
+    detail::GrpcContextThreadContext& context) noexcept
+{
+    auto& local_high_priority_work_queue = context.local_high_priority_work_queue_;
+    if (local_high_priority_work_queue.empty())
+    {
+        return false;
+    }
+    agrpc::GrpcContext& grpc_context = context.grpc_context_;
+    (void)grpc_context.remote_high_priority_work_queue_.prepend(std::move(local_high_priority_work_queue));
+    return GrpcContextImplementation::mark_remote_work_active_for_high_priority_work(grpc_context);
+}
+
 inline bool GrpcContextImplementation::move_remote_work_to_local_queue(
     detail::GrpcContextThreadContext& context) noexcept
 {
     agrpc::GrpcContext& grpc_context = context.grpc_context_;
-    return !grpc_context.remote_work_queue_.dequeue_all_and_try_mark_inactive(context.local_work_queue_);
+    grpc_context.remote_high_priority_work_queue_.dequeue_all(context.local_high_priority_work_queue_);
+    if (!grpc_context.remote_work_queue_.dequeue_all_and_try_mark_inactive(context.local_work_queue_))
+    {
+        return true;
+    }
+    return !grpc_context.remote_high_priority_work_queue_.empty() && grpc_context.remote_work_queue_.try_mark_active();
+}
+
+inline void GrpcContextImplementation::move_remote_work_to_local_queue_and_keep_active(
+    detail::GrpcContextThreadContext& context) noexcept
+{
+    agrpc::GrpcContext& grpc_context = context.grpc_context_;
+    grpc_context.remote_high_priority_work_queue_.dequeue_all(context.local_high_priority_work_queue_);
+    grpc_context.remote_work_queue_.dequeue_all(context.local_work_queue_);
+}
+
+inline bool GrpcContextImplementation::try_mark_remote_work_inactive(detail::GrpcContextThreadContext& context) noexcept
+{
+    agrpc::GrpcContext& grpc_context = context.grpc_context_;
+    if (!grpc_context.remote_work_queue_.try_mark_inactive())
+    {
+        return false;
+    }
+    // High priority work that has been added in the meantime did not see the inactive remote work queue. If the queue
+    // cannot be marked active again then another thread did so and triggers the work alarm.
+    return grpc_context.remote_high_priority_work_queue_.empty() || !grpc_context.remote_work_queue_.try_mark_active();
+}
+
+inline bool GrpcContextImplementation::has_idle_threads(const agrpc::GrpcContext& grpc_context) noexcept
+{
+    return grpc_context.busy_thread_count_.load(std::memory_order_relaxed) < grpc_context.concurrency_hint_;
 }
 
 inline bool GrpcContextImplementation::distribute_all_local_work_to_other_threads_but_one(
     detail::GrpcContextThreadContext& context) noexcept
 {
-    if (auto& local_work_queue = context.local_work_queue_; !local_work_queue.empty())
+    // Under full load every thread has enough work of its own. Handing work off would only add contention on the
+    // remote work queue and wake-ups through the work alarm.
+    if (auto& local_work_queue = context.local_work_queue_;
+        !local_work_queue.empty() && GrpcContextImplementation::has_idle_threads(context.grpc_context_))
     {
         const auto first = local_work_queue.pop_front();
         const bool needs_trigger = GrpcContextImplementation::move_local_queue_to_remote_work(context);
@@ -150,6 +347,96 @@ inline bool GrpcContextImplementation::distribute_all_local_work_to_other_thread
     return false;
 }
 
+inline void GrpcContextImplementation::share_local_work(detail::GrpcContextThreadContext& context)
+{
+    auto& local_work_queue = context.local_work_queue_;
+    if (local_work_queue.empty())
+    {
+        return;
+    }
+    // The first operation is older than the shared work, the rest is newer
+    auto* const first_operation = local_work_queue.pop_front();
+    if (local_work_queue.empty())
+    {
+        local_work_queue.push_back(first_operation);
+        return;
+    }
+    auto& hook = *context.grpc_context_.work_stealing_hook_;
+    {
+        std::lock_guard guard{hook.shared_work_mutex_};
+        hook.shared_work_.append(std::move(local_work_queue));
+        // Sequentially consistent so that either find_thief_ sees a GrpcContext that has started waiting or that
+        // GrpcContext sees the shared work in steal_
+        hook.has_shared_work_.store(true, std::memory_order_seq_cst);
+    }
+    local_work_queue.push_back(first_operation);
+    GrpcContextImplementation::wake_up_thief(hook);
+}
+
+inline void GrpcContextImplementation::take_shared_operation(detail::GrpcContextThreadContext& context)
+{
+    auto* const hook = context.grpc_context_.work_stealing_hook_;
+    if (hook == nullptr || !hook->has_shared_work_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::lock_guard guard{hook->shared_work_mutex_};
+    if (!hook->shared_work_.empty())
+    {
+        context.local_work_queue_.push_back(hook->shared_work_.pop_front());
+        hook->has_shared_work_.store(!hook->shared_work_.empty(), std::memory_order_relaxed);
+    }
+}
+
+inline void GrpcContextImplementation::take_back_shared_work(detail::GrpcContextThreadContext& context)
+{
+    auto* const hook = context.grpc_context_.work_stealing_hook_;
+    if (hook == nullptr)
+    {
+        return;
+    }
+    std::lock_guard guard{hook->shared_work_mutex_};
+    context.local_work_queue_.append(std::move(hook->shared_work_));
+    hook->has_shared_work_.store(false, std::memory_order_relaxed);
+}
+
+inline bool GrpcContextImplementation::steal_shared_work(agrpc::GrpcContext& grpc_context)
+{
+    auto& hook = *grpc_context.work_stealing_hook_;
+    if (grpc_context.is_stopped() || !hook.has_shared_work_.load(std::memory_order_seq_cst))
+    {
+        return false;
+    }
+    detail::QueueableOperationBase* operation;
+    bool has_more_shared_work;
+    {
+        std::lock_guard guard{hook.shared_work_mutex_};
+        if (hook.shared_work_.empty())
+        {
+            return false;
+        }
+        operation = hook.shared_work_.pop_front();
+        has_more_shared_work = !hook.shared_work_.empty();
+        hook.has_shared_work_.store(has_more_shared_work, std::memory_order_relaxed);
+    }
+    if (has_more_shared_work)
+    {
+        GrpcContextImplementation::wake_up_thief(hook);
+    }
+    detail::WorkFinishedOnExit on_exit{grpc_context};
+    operation->complete(detail::OperationResult::OK_, grpc_context);
+    return true;
+}
+
+inline void GrpcContextImplementation::wake_up_thief(detail::WorkStealingHook& hook) noexcept
+{
+    if (auto* const thief = hook.find_thief_(hook))
+    {
+        GrpcContextImplementation::work_started(*thief);
+        GrpcContextImplementation::add_remote_operation(*thief, &hook);
+    }
+}
+
 inline bool GrpcContextImplementation::process_local_queue(detail::GrpcContextThreadContext& context,
                                                            detail::InvokeHandler invoke)
 {
@@ -157,29 +444,217 @@ inline bool GrpcContextImplementation::process_local_queue(detail::GrpcContextTh
     bool processed{};
     const auto result =
         detail::InvokeHandler::NO_ == invoke ? detail::OperationResult::SHUTDOWN_NOT_OK : detail::OperationResult::OK_;
+    auto high_priority_queue{std::move(context.local_high_priority_work_queue_)};
     auto queue{std::move(context.local_work_queue_)};
-    while (!queue.empty())
+    const auto budget = detail::InvokeHandler::NO_ == invoke
+                            ? std::size_t{}
+                            : grpc_context.local_work_budget_.load(std::memory_order_relaxed);
+    auto remaining = budget == 0 ? std::numeric_limits<std::size_t>::max() : budget;
+    while (remaining != 0)
     {
+        detail::QueueableOperationBase* operation;
+        if AGRPC_UNLIKELY (!high_priority_queue.empty())
+        {
+            operation = high_priority_queue.pop_front();
+        }
+        // Stop early when high priority work has been added so that it runs before the rest of the queue
+        else if (!queue.empty() && context.local_high_priority_work_queue_.empty())
+        {
+            operation = queue.pop_front();
+        }
+        else
+        {
+            break;
+        }
+        --remaining;
         processed = true;
-        detail::WorkFinishedOnExit on_exit{grpc_context};
-        auto* operation = queue.pop_front();
+        detail::WorkFinishedOnExit on_exit{context};
         operation->complete(result, grpc_context);
     }
+    if AGRPC_UNLIKELY (!high_priority_queue.empty())
+    {
+        high_priority_queue.append(std::move(context.local_high_priority_work_queue_));
+        context.local_high_priority_work_queue_ = std::move(high_priority_queue);
+    }
+    if (!queue.empty())
+    {
+        // Budget exhausted or interrupted by high priority work, put the rest back in front of the work that has been
+        // queued in the meantime
+        queue.append(std::move(context.local_work_queue_));
+        context.local_work_queue_ = std::move(queue);
+    }
     return processed;
 }
 
+inline bool is_time_zero(::gpr_timespec deadline) noexcept
+{
+    return deadline.tv_sec == GrpcContextImplementation::TIME_ZERO.tv_sec;
+}
+
 inline bool get_next_event(grpc::CompletionQueue* cq, detail::GrpcCompletionQueueEvent& event,
                            ::gpr_timespec deadline) noexcept
 {
     return grpc::CompletionQueue::GOT_EVENT == cq->AsyncNext(&event.tag_, &event.ok_, deadline);
 }
 
+inline std::chrono::nanoseconds::rep steady_clock_nanoseconds(
+    std::chrono::steady_clock::time_point time_point = std::chrono::steady_clock::now()) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time_point.time_since_epoch()).count();
+}
+
+inline bool GrpcContextImplementation::get_next_event(agrpc::GrpcContext& grpc_context,
+                                                      detail::GrpcCompletionQueueEvent& event, ::gpr_timespec deadline,
+                                                      detail::InvokeHandler invoke) noexcept
+{
+    auto* const completion_queue = grpc_context.get_completion_queue();
+    if (detail::InvokeHandler::NO_ == invoke)
+    {
+        return detail::get_next_event(completion_queue, event, deadline);
+    }
+    if (detail::is_time_zero(deadline))
+    {
+        if (detail::get_next_event(completion_queue, event, deadline))
+        {
+            return true;
+        }
+        GrpcContextImplementation::mark_completion_queue_empty(grpc_context);
+        return false;
+    }
+    // An event that arrives while waiting has not been queued. Make sure that none has been queued before waiting.
+    if AGRPC_UNLIKELY (GrpcContextImplementation::is_tracking_queue_delay(grpc_context) &&
+                       detail::get_next_event(completion_queue, event, GrpcContextImplementation::TIME_ZERO))
+    {
+        return true;
+    }
+    bool got_event;
+    if (!grpc_context.multithreaded_)
+    {
+        got_event = GrpcContextImplementation::wait_for_next_event(grpc_context, event, deadline);
+    }
+    else
+    {
+        // Let the other threads know that this one is idle so that they hand off some of their local work
+        grpc_context.busy_thread_count_.fetch_sub(1, std::memory_order_relaxed);
+        got_event = GrpcContextImplementation::wait_for_next_event(grpc_context, event, deadline);
+        grpc_context.busy_thread_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    GrpcContextImplementation::mark_completion_queue_empty(grpc_context);
+    return got_event;
+}
+
+inline bool GrpcContextImplementation::is_tracking_queue_delay(const agrpc::GrpcContext& grpc_context) noexcept
+{
+    return grpc_context.queue_delay_counters_.trackers_.load(std::memory_order_relaxed) != 0;
+}
+
+inline void GrpcContextImplementation::mark_completion_queue_empty(agrpc::GrpcContext& grpc_context) noexcept
+{
+    if AGRPC_UNLIKELY (GrpcContextImplementation::is_tracking_queue_delay(grpc_context))
+    {
+        grpc_context.queue_delay_counters_.empty_time_.store(detail::steady_clock_nanoseconds(),
+                                                             std::memory_order_relaxed);
+    }
+}
+
+inline void GrpcContextImplementation::start_tracking_queue_delay(agrpc::GrpcContext& grpc_context) noexcept
+{
+    auto& counters = grpc_context.queue_delay_counters_;
+    if (0 == counters.trackers_.fetch_add(1, std::memory_order_relaxed))
+    {
+        counters.empty_time_.store(detail::steady_clock_nanoseconds(), std::memory_order_relaxed);
+    }
+}
+
+inline void GrpcContextImplementation::stop_tracking_queue_delay(agrpc::GrpcContext& grpc_context) noexcept
+{
+    grpc_context.queue_delay_counters_.trackers_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline std::chrono::nanoseconds GrpcContextImplementation::queue_delay(
+    const agrpc::GrpcContext& grpc_context, std::chrono::steady_clock::time_point now) noexcept
+{
+    // Another thread may have found the queue empty after `now` was taken
+    const auto empty_time = grpc_context.queue_delay_counters_.empty_time_.load(std::memory_order_relaxed);
+    const auto delay = detail::steady_clock_nanoseconds(now) - empty_time;
+    return std::chrono::nanoseconds{(std::max)(delay, std::chrono::nanoseconds::rep{})};
+}
+
+inline void GrpcContextImplementation::record_queue_delay(agrpc::GrpcContext& grpc_context,
+                                                          std::chrono::nanoseconds delay, bool rejected) noexcept
+{
+    auto& counters = grpc_context.queue_delay_counters_;
+    counters.total_delay_.fetch_add(delay.count(), std::memory_order_relaxed);
+    auto max_delay = counters.max_delay_.load(std::memory_order_relaxed);
+    while (delay.count() > max_delay &&
+           !counters.max_delay_.compare_exchange_weak(max_delay, delay.count(), std::memory_order_relaxed))
+    {
+    }
+    counters.rpcs_.fetch_add(1, std::memory_order_relaxed);
+    if (rejected)
+    {
+        counters.rejected_rpcs_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline bool GrpcContextImplementation::wait_for_next_event(agrpc::GrpcContext& grpc_context,
+                                                           detail::GrpcCompletionQueueEvent& event,
+                                                           ::gpr_timespec deadline) noexcept
+{
+    const auto busy_poll_duration = grpc_context.busy_poll_duration_.load(std::memory_order_relaxed);
+    if AGRPC_UNLIKELY (busy_poll_duration > 0)
+    {
+        return GrpcContextImplementation::busy_poll_next_event(grpc_context, event, deadline,
+                                                               std::chrono::nanoseconds{busy_poll_duration});
+    }
+    return detail::get_next_event(grpc_context.get_completion_queue(), event, deadline);
+}
+
+inline bool GrpcContextImplementation::busy_poll_next_event(agrpc::GrpcContext& grpc_context,
+                                                            detail::GrpcCompletionQueueEvent& event,
+                                                            ::gpr_timespec deadline,
+                                                            std::chrono::nanoseconds busy_poll_duration) noexcept
+{
+    auto* const completion_queue = grpc_context.get_completion_queue();
+    auto& counters = grpc_context.busy_poll_counters_;
+    auto now = std::chrono::steady_clock::now();
+    const auto spin_start = now;
+    const auto spin_end = spin_start + busy_poll_duration;
+    const auto spin_end_timespec =
+        ::gpr_time_add(::gpr_now(deadline.clock_type), ::gpr_time_from_nanos(busy_poll_duration.count(), GPR_TIMESPAN));
+    // Do not spin past the deadline
+    if (::gpr_time_cmp(deadline, spin_end_timespec) >= 0)
+    {
+        bool got_event{};
+        do
+        {
+            got_event = detail::get_next_event(completion_queue, event, GrpcContextImplementation::TIME_ZERO);
+            now = std::chrono::steady_clock::now();
+        } while (!got_event && now < spin_end);
+        counters.spin_duration_.fetch_add((now - spin_start).count(), std::memory_order_relaxed);
+        if (got_event)
+        {
+            counters.spin_events_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    const auto sleep_start = now;
+    const bool got_event = detail::get_next_event(completion_queue, event, deadline);
+    counters.sleep_duration_.fetch_add((std::chrono::steady_clock::now() - sleep_start).count(),
+                                       std::memory_order_relaxed);
+    if (got_event)
+    {
+        counters.sleep_events_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return got_event;
+}
+
 inline CompletionQueueEventResult GrpcContextImplementation::do_one_completion_queue_event(
     detail::GrpcContextThreadContext& context, ::gpr_timespec deadline, detail::InvokeHandler invoke)
 {
     agrpc::GrpcContext& grpc_context = context.grpc_context_;
     if (detail::GrpcCompletionQueueEvent event;
-        detail::get_next_event(grpc_context.get_completion_queue(), event, deadline))
+        GrpcContextImplementation::get_next_event(grpc_context, event, deadline, invoke))
     {
         if (GrpcContextImplementation::CHECK_REMOTE_WORK_TAG == event.tag_)
         {
@@ -217,13 +692,26 @@ inline DoOneResult GrpcContextImplementation::do_one(detail::GrpcContextThreadCo
     }
     else
     {
+        // The remote work queue is kept active for as long as this thread is busy. That way, other threads can add
+        // remote work without triggering the work alarm.
         if (check_remote_work)
         {
-            check_remote_work = GrpcContextImplementation::move_remote_work_to_local_queue(context);
+            GrpcContextImplementation::move_remote_work_to_local_queue_and_keep_active(context);
+        }
+        if (context.grpc_context_.work_stealing_hook_ != nullptr)
+        {
+            GrpcContextImplementation::share_local_work(context);
         }
     }
     context.check_remote_work_ = check_remote_work;
     const bool processed_local_work = GrpcContextImplementation::process_local_queue(context, invoke);
+    if constexpr (!IsMultithreaded)
+    {
+        if (local_work_queue.empty())
+        {
+            GrpcContextImplementation::take_shared_operation(context);
+        }
+    }
     if constexpr (IsMultithreaded)
     {
         if (GrpcContextImplementation::distribute_all_local_work_to_other_threads_but_one(context))
@@ -231,13 +719,73 @@ inline DoOneResult GrpcContextImplementation::do_one(detail::GrpcContextThreadCo
             GrpcContextImplementation::trigger_work_alarm(context.grpc_context_);
         }
     }
-    const bool is_more_completed_work_pending = check_remote_work || !local_work_queue.empty();
+    bool is_more_completed_work_pending = !local_work_queue.empty() || !context.local_high_priority_work_queue_.empty();
+    if constexpr (IsMultithreaded)
+    {
+        if (!is_more_completed_work_pending)
+        {
+            // This thread might go to sleep, let the GrpcContext know about the work that has finished in the meantime
+            GrpcContextImplementation::flush_finished_outstanding_work(context);
+        }
+    }
+    else
+    {
+        if (!is_more_completed_work_pending && context.check_remote_work_)
+        {
+            // Before going to sleep, handle a completion queue event that is already available. Only once there is
+            // none, mark the remote work queue as inactive so that the next remote work triggers the work alarm.
+            if (!detail::is_time_zero(deadline) && loop_condition())
+            {
+                const auto handled_event = GrpcContextImplementation::do_one_completion_queue_event(
+                    context, GrpcContextImplementation::TIME_ZERO, invoke);
+                if (handled_event.handled_event())
+                {
+                    return DoOneResult::from(handled_event, processed_local_work);
+                }
+            }
+            if (GrpcContextImplementation::try_mark_remote_work_inactive(context))
+            {
+                context.check_remote_work_ = false;
+            }
+            else
+            {
+                is_more_completed_work_pending = true;
+            }
+        }
+        auto* const hook = context.grpc_context_.work_stealing_hook_;
+        if (hook != nullptr && !is_more_completed_work_pending && !detail::is_time_zero(deadline) && loop_condition())
+        {
+            // Help out the other GrpcContexts of the pool one operation at a time before going to sleep. The remote
+            // work queue is marked inactive at this point, see share_local_work.
+            const auto handled_event = GrpcContextImplementation::do_one_completion_queue_event(
+                context, GrpcContextImplementation::TIME_ZERO, invoke);
+            if (handled_event.handled_event())
+            {
+                return DoOneResult::from(handled_event, processed_local_work);
+            }
+            if (hook->steal_(*hook))
+            {
+                return {{DoOneResult::PROCESSED_LOCAL_WORK}};
+            }
+        }
+    }
     if (!is_more_completed_work_pending && !loop_condition())
     {
         return {{DoOneResult::PROCESSED_LOCAL_WORK}};
     }
-    const auto handled_event = GrpcContextImplementation::do_one_completion_queue_event(
+    auto handled_event = GrpcContextImplementation::do_one_completion_queue_event(
         context, is_more_completed_work_pending ? GrpcContextImplementation::TIME_ZERO : deadline, invoke);
+    const auto batch_size = context.grpc_context_.completion_queue_batch_size_.load(std::memory_order_relaxed);
+    for (std::size_t i{1}; i < batch_size && handled_event.handled_event() && loop_condition(); ++i)
+    {
+        const auto next_event = GrpcContextImplementation::do_one_completion_queue_event(
+            context, GrpcContextImplementation::TIME_ZERO, invoke);
+        if (!next_event.handled_event())
+        {
+            break;
+        }
+        handled_event.flags_ |= next_event.flags_;
+    }
     return DoOneResult::from(handled_event, processed_local_work);
 }
 
@@ -249,9 +797,14 @@ bool run_loop(detail::GrpcContextThreadContextImpl<IsMultithreaded>& thread_cont
     DoOneResult result;
     while (loop_condition())
     {
+        GrpcContextImplementation::trim_memory_resource_if_requested(thread_context);
         if constexpr (LoopCondition::COMPLETION_QUEUE_ONLY)
         {
             result = {GrpcContextImplementation::do_one_completion_queue_event(thread_context, deadline)};
+            if constexpr (IsMultithreaded)
+            {
+                GrpcContextImplementation::flush_finished_outstanding_work(thread_context);
+            }
         }
         else
         {
@@ -300,6 +853,7 @@ inline void GrpcContextImplementation::drain_completion_queue(agrpc::GrpcContext
     detail::GrpcContextThreadContextImpl<false> thread_context{grpc_context};
     (void)grpc_context.remote_work_queue_.try_mark_active();
     (void)GrpcContextImplementation::move_remote_work_to_local_queue(thread_context);
+    GrpcContextImplementation::take_back_shared_work(thread_context);
     GrpcContextImplementation::process_local_queue(thread_context, detail::InvokeHandler::NO_);
     while (GrpcContextImplementation::do_one_completion_queue_event(
                thread_context, detail::GrpcContextImplementation::INFINITE_FUTURE, detail::InvokeHandler::NO_)
@@ -309,22 +863,291 @@ inline void GrpcContextImplementation::drain_completion_queue(agrpc::GrpcContext
     }
 }
 
+inline std::uint64_t timespec_to_tick(::gpr_timespec deadline, std::chrono::nanoseconds::rep resolution,
+                                      bool round_up) noexcept
+{
+    static constexpr std::int64_t NANOSECONDS_PER_SECOND = 1'000'000'000;
+    deadline = ::gpr_convert_clock_type(deadline, GPR_CLOCK_MONOTONIC);
+    if (deadline.tv_sec < 0)
+    {
+        return 0;
+    }
+    if (deadline.tv_sec >= std::numeric_limits<std::int64_t>::max() / NANOSECONDS_PER_SECOND)
+    {
+        return detail::TimerWheel::NO_TICK;
+    }
+    const auto nanoseconds = static_cast<std::uint64_t>(deadline.tv_sec * NANOSECONDS_PER_SECOND + deadline.tv_nsec);
+    const auto tick_duration = static_cast<std::uint64_t>(resolution);
+    return (round_up ? nanoseconds + tick_duration - 1 : nanoseconds) / tick_duration;
+}
+
+inline ::gpr_timespec tick_to_timespec(std::uint64_t tick, std::chrono::nanoseconds::rep resolution) noexcept
+{
+    return ::gpr_time_from_nanos(static_cast<std::int64_t>(tick) * resolution, GPR_CLOCK_MONOTONIC);
+}
+
+inline void TimerWheelOperation::do_complete(detail::OperationBase*, detail::OperationResult result,
+                                             agrpc::GrpcContext& grpc_context)
+{
+    GrpcContextImplementation::process_alarm_timer_wheel(grpc_context, result);
+}
+
+inline AlarmTimerWheelHandle::AlarmTimerWheelHandle(AlarmTimerWheelHandle&& other) noexcept
+{
+    GrpcContextImplementation::move_alarm(*this, other);
+}
+
+inline AlarmTimerWheelHandle::~AlarmTimerWheelHandle() noexcept { GrpcContextImplementation::release_alarm(*this); }
+
+inline AlarmTimerWheelHandle& AlarmTimerWheelHandle::operator=(AlarmTimerWheelHandle&& other) noexcept
+{
+    if (this != &other)
+    {
+        GrpcContextImplementation::release_alarm(*this);
+        GrpcContextImplementation::move_alarm(*this, other);
+    }
+    return *this;
+}
+
+inline bool GrpcContextImplementation::is_alarm_timer_wheel_enabled(const agrpc::GrpcContext& grpc_context) noexcept
+{
+    // The timer wheel is created before the resolution is set
+    return grpc_context.alarm_resolution_.load(std::memory_order_relaxed) > 0;
+}
+
+inline bool GrpcContextImplementation::add_alarm(agrpc::GrpcContext& grpc_context,
+                                                 detail::AlarmTimerWheelHandle& handle, ::gpr_timespec deadline,
+                                                 void* tag)
+{
+    const auto resolution = grpc_context.alarm_resolution_.load(std::memory_order_relaxed);
+    auto* const timer_wheel_ptr = grpc_context.alarm_timer_wheel_.load(std::memory_order_acquire);
+    if (resolution <= 0 || timer_wheel_ptr == nullptr)
+    {
+        return false;
+    }
+    auto& timer_wheel = *timer_wheel_ptr;
+    std::lock_guard guard{timer_wheel.mutex_};
+    auto& wheel = timer_wheel.wheel_;
+    if (wheel.empty())
+    {
+        // The resolution of the wheel can only change while it is empty
+        if (resolution != timer_wheel.resolution_)
+        {
+            timer_wheel.resolution_ = resolution;
+            if (timer_wheel.is_armed_ && !timer_wheel.is_cancelling_)
+            {
+                timer_wheel.is_cancelling_ = true;
+                timer_wheel.alarm_.Cancel();
+            }
+        }
+        wheel.reset(detail::timespec_to_tick(::gpr_now(GPR_CLOCK_MONOTONIC), resolution, false));
+    }
+    auto& entry = timer_wheel.allocate_entry();
+    entry.tag_ = tag;
+    entry.handle_ = &handle;
+    wheel.add(entry, detail::timespec_to_tick(deadline, timer_wheel.resolution_, true));
+    handle.grpc_context_ = &grpc_context;
+    handle.entry_.store(&entry, std::memory_order_release);
+    GrpcContextImplementation::arm_alarm_timer_wheel(grpc_context);
+    return true;
+}
+
+inline void GrpcContextImplementation::cancel_alarm(const detail::AlarmTimerWheelHandle& handle) noexcept
+{
+    if (handle.entry_.load(std::memory_order_acquire) == nullptr)
+    {
+        return;
+    }
+    auto& grpc_context = *handle.grpc_context_;
+    auto& timer_wheel = *grpc_context.alarm_timer_wheel_.load(std::memory_order_relaxed);
+    std::lock_guard guard{timer_wheel.mutex_};
+    auto* const entry = handle.entry_.load(std::memory_order_relaxed);
+    if (entry == nullptr)
+    {
+        // The wait has already completed
+        return;
+    }
+    timer_wheel.wheel_.expire(*entry, false);
+    GrpcContextImplementation::arm_alarm_timer_wheel(grpc_context);
+}
+
+inline void GrpcContextImplementation::release_alarm(detail::AlarmTimerWheelHandle& handle) noexcept
+{
+    if (handle.entry_.load(std::memory_order_acquire) == nullptr)
+    {
+        return;
+    }
+    auto& grpc_context = *handle.grpc_context_;
+    auto& timer_wheel = *grpc_context.alarm_timer_wheel_.load(std::memory_order_relaxed);
+    std::lock_guard guard{timer_wheel.mutex_};
+    auto* const entry = handle.entry_.exchange(nullptr, std::memory_order_relaxed);
+    if (entry == nullptr)
+    {
+        return;
+    }
+    // The wait still completes with `false`, but without clearing the handle
+    entry->handle_ = nullptr;
+    timer_wheel.wheel_.expire(*entry, false);
+    GrpcContextImplementation::arm_alarm_timer_wheel(grpc_context);
+}
+
+inline void GrpcContextImplementation::move_alarm(detail::AlarmTimerWheelHandle& to,
+                                                  detail::AlarmTimerWheelHandle& from) noexcept
+{
+    to.grpc_context_ = from.grpc_context_;
+    if (from.entry_.load(std::memory_order_acquire) == nullptr)
+    {
+        return;
+    }
+    auto& timer_wheel = *from.grpc_context_->alarm_timer_wheel_.load(std::memory_order_relaxed);
+    std::lock_guard guard{timer_wheel.mutex_};
+    auto* const entry = from.entry_.exchange(nullptr, std::memory_order_relaxed);
+    if (entry != nullptr)
+    {
+        entry->handle_ = &to;
+        to.entry_.store(entry, std::memory_order_relaxed);
+    }
+}
+
+inline void GrpcContextImplementation::arm_alarm_timer_wheel(agrpc::GrpcContext& grpc_context) noexcept
+{
+    auto& timer_wheel = *grpc_context.alarm_timer_wheel_.load(std::memory_order_relaxed);
+    if (timer_wheel.wheel_.empty())
+    {
+        return;
+    }
+    const auto tick = timer_wheel.wheel_.next_tick();
+    if (timer_wheel.is_armed_)
+    {
+        // Once cancelled, the grpc::Alarm completes soon and is then set for the earliest tick
+        if (tick < timer_wheel.armed_tick_ && !timer_wheel.is_cancelling_)
+        {
+            timer_wheel.is_cancelling_ = true;
+            timer_wheel.alarm_.Cancel();
+        }
+        return;
+    }
+    grpc_context.work_started();
+    timer_wheel.is_armed_ = true;
+    timer_wheel.armed_tick_ = tick;
+    timer_wheel.alarm_.Set(grpc_context.get_completion_queue(),
+                           detail::tick_to_timespec(tick, timer_wheel.resolution_), &timer_wheel.operation_);
+}
+
+inline void GrpcContextImplementation::process_alarm_timer_wheel(agrpc::GrpcContext& grpc_context,
+                                                                 detail::OperationResult result)
+{
+    auto& timer_wheel = *grpc_context.alarm_timer_wheel_.load(std::memory_order_relaxed);
+    const bool is_shutdown = detail::is_shutdown(result);
+    {
+        std::lock_guard guard{timer_wheel.mutex_};
+        timer_wheel.is_armed_ = false;
+        timer_wheel.is_cancelling_ = false;
+        if (is_shutdown)
+        {
+            timer_wheel.wheel_.expire_all(false);
+        }
+        else
+        {
+            timer_wheel.wheel_.advance(detail::timespec_to_tick(::gpr_now(GPR_CLOCK_MONOTONIC),
+                                                                timer_wheel.resolution_, false));
+        }
+    }
+    while (true)
+    {
+        void* tag;
+        bool ok;
+        {
+            std::lock_guard lock{timer_wheel.mutex_};
+            auto* const entry = timer_wheel.wheel_.pop_expired();
+            if (entry == nullptr)
+            {
+                break;
+            }
+            tag = entry->tag_;
+            ok = entry->ok_;
+            if (entry->handle_ != nullptr)
+            {
+                entry->handle_->entry_.store(nullptr, std::memory_order_relaxed);
+            }
+            timer_wheel.deallocate_entry(*entry);
+        }
+        detail::process_grpc_tag(tag,
+                                 is_shutdown ? detail::OperationResult::SHUTDOWN_NOT_OK
+                                 : ok        ? detail::OperationResult::OK_
+                                             : detail::OperationResult::NOT_OK,
+                                 grpc_context);
+    }
+    if (!is_shutdown)
+    {
+        std::lock_guard guard{timer_wheel.mutex_};
+        GrpcContextImplementation::arm_alarm_timer_wheel(grpc_context);
+    }
+}
+
+inline void GrpcContextImplementation::shutdown_alarm_timer_wheel(agrpc::GrpcContext& grpc_context) noexcept
+{
+    // Pending entries are destroyed once the cancelled grpc::Alarm is drained from the completion queue
+    auto* const timer_wheel_ptr = grpc_context.alarm_timer_wheel_.load(std::memory_order_relaxed);
+    if (timer_wheel_ptr == nullptr)
+    {
+        return;
+    }
+    auto& timer_wheel = *timer_wheel_ptr;
+    std::lock_guard guard{timer_wheel.mutex_};
+    if (timer_wheel.is_armed_ && !timer_wheel.is_cancelling_)
+    {
+        timer_wheel.is_cancelling_ = true;
+        timer_wheel.alarm_.Cancel();
+    }
+}
+
 inline detail::ListablePoolResource& GrpcContextImplementation::pop_resource(agrpc::GrpcContext& grpc_context)
 {
+    // The resource that this thread used last is most likely still free
+    const auto& cached = detail::thread_cached_pool_resource;
+    if AGRPC_LIKELY (cached.owner_id_ == grpc_context.memory_resources_owner_id_ &&
+                     detail::try_acquire_resource(*cached.resource_))
+    {
+        return *cached.resource_;
+    }
     std::lock_guard guard{grpc_context.memory_resources_mutex_};
-    auto& resources = grpc_context.memory_resources_;
-    if (resources.empty())
+    for (auto* resource = grpc_context.created_memory_resources_; resource != nullptr;
+         resource = resource->next_created_)
     {
-        return *(new detail::ListablePoolResource{});
+        if (detail::try_acquire_resource(*resource))
+        {
+            return *resource;
+        }
     }
-    return resources.pop_front();
+    auto& resource =
+        detail::create_resource(grpc_context.created_memory_resources_, grpc_context.largest_pooled_block_size_);
+    resource.in_use_.store(true, std::memory_order_relaxed);
+    return resource;
 }
 
 inline void GrpcContextImplementation::push_resource(agrpc::GrpcContext& grpc_context,
-                                                     detail::ListablePoolResource& resource)
+                                                     detail::ListablePoolResource& resource) noexcept
 {
-    std::lock_guard guard{grpc_context.memory_resources_mutex_};
-    grpc_context.memory_resources_.push_front(resource);
+    detail::release_resource(resource);
+    detail::thread_cached_pool_resource = {grpc_context.memory_resources_owner_id_, &resource};
+}
+
+inline void GrpcContextImplementation::trim_memory_resource(detail::ListablePoolResource& resource,
+                                                            std::uint64_t epoch) noexcept
+{
+    resource.trim_epoch_ = epoch;
+    resource.resource_.trim();
+}
+
+inline void GrpcContextImplementation::trim_memory_resource_if_requested(
+    detail::GrpcContextThreadContext& context) noexcept
+{
+    const auto epoch = context.grpc_context_.memory_resources_trim_epoch_.load(std::memory_order_relaxed);
+    if AGRPC_UNLIKELY (epoch != context.resource_.trim_epoch_)
+    {
+        GrpcContextImplementation::trim_memory_resource(context.resource_, epoch);
+    }
 }
 
 inline bool GrpcContextImplementation::is_multithreaded(const agrpc::GrpcContext& grpc_context)
@@ -332,6 +1155,23 @@ inline bool GrpcContextImplementation::is_multithreaded(const agrpc::GrpcContext
     return grpc_context.multithreaded_;
 }
 
+inline long GrpcContextImplementation::outstanding_work(const agrpc::GrpcContext& grpc_context) noexcept
+{
+    return grpc_context.outstanding_work_.load(std::memory_order_relaxed);
+}
+
+inline bool GrpcContextImplementation::is_waiting_for_remote_work(const agrpc::GrpcContext& grpc_context) noexcept
+{
+    // A single-threaded GrpcContext marks its remote work queue inactive right before it waits for the completion queue
+    return !grpc_context.is_stopped() && grpc_context.remote_work_queue_.is_marked_inactive();
+}
+
+inline void GrpcContextImplementation::set_work_stealing_hook(agrpc::GrpcContext& grpc_context,
+                                                              detail::WorkStealingHook& hook) noexcept
+{
+    grpc_context.work_stealing_hook_ = &hook;
+}
+
 inline void process_grpc_tag(void* tag, detail::OperationResult result, agrpc::GrpcContext& grpc_context)
 {
     detail::WorkFinishedOnExit on_exit{grpc_context};
@@ -356,40 +1196,93 @@ inline detail::PoolResource& get_local_pool_resource() noexcept
 template <class T>
 inline T* PoolResourceAllocator<T>::allocate(std::size_t n)
 {
-    if constexpr (alignof(T) > MAX_ALIGN)
+    const auto size = n * sizeof(T);
+    if (detail::get_pool_allocation_size(size, alignof(T)) > LARGEST_POOL_BLOCK_SIZE)
     {
         return std::allocator<T>{}.allocate(n);
     }
-    else
+    if AGRPC_UNLIKELY (detail::thread_local_grpc_context == nullptr)
     {
-        const auto allocation_size = n * sizeof(T);
-        if (allocation_size > LARGEST_POOL_BLOCK_SIZE)
-        {
-            return std::allocator<T>{}.allocate(n);
-        }
-        return static_cast<T*>(detail::get_local_pool_resource().allocate(allocation_size));
+        return static_cast<T*>(detail::PoolResource::allocate_unowned(size, alignof(T)));
     }
+    return static_cast<T*>(detail::get_local_pool_resource().allocate(size, alignof(T)));
 }
 
 template <class T>
 inline void PoolResourceAllocator<T>::deallocate(T* p, std::size_t n) noexcept
 {
-    if constexpr (alignof(T) > MAX_ALIGN)
+    const auto size = n * sizeof(T);
+    if (detail::get_pool_allocation_size(size, alignof(T)) > LARGEST_POOL_BLOCK_SIZE)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    else if AGRPC_UNLIKELY (detail::thread_local_grpc_context == nullptr)
+    {
+        detail::PoolResource::deallocate_unowned(p, size, alignof(T));
+    }
+    else
+    {
+        detail::get_local_pool_resource().deallocate(p, size, alignof(T));
+    }
+}
+
+// Frames are rounded up to the size classes of the GrpcContext's memory resources. Size classes that the GrpcContext
+// running on the current thread pools are served by it, all other size classes by the thread-local frame cache.
+inline void* allocate_coroutine_frame(std::size_t frame_size)
+{
+    auto size = frame_size + COROUTINE_FRAME_HEADER_SIZE;
+    void* p;
+    if AGRPC_UNLIKELY (size > LARGEST_POOL_BLOCK_SIZE)
     {
-        return std::allocator<T>{}.deallocate(p);
+        size = detail::align(size, MAX_ALIGN);
+        p = detail::allocate_already_max_aligned(size);
     }
     else
     {
-        const auto allocation_size = n * sizeof(T);
-        if (allocation_size > LARGEST_POOL_BLOCK_SIZE)
+        size = detail::round_to_pool_block_size(size);
+        const auto* const context = detail::thread_local_grpc_context;
+        if (context != nullptr && size <= context->grpc_context_.max_pooled_allocation_size())
         {
-            std::allocator<T>{}.deallocate(p, n);
+            p = detail::get_local_pool_resource().allocate(size);
         }
         else
         {
-            detail::get_local_pool_resource().deallocate(p, allocation_size);
+            p = detail::thread_local_coroutine_frame_cache.pop(detail::get_pool_index(size));
+            if (p == nullptr)
+            {
+                p = detail::PoolResource::allocate_unowned(size, MAX_ALIGN);
+            }
         }
     }
+    ::new (p) CoroutineFrameHeader{size};
+    return static_cast<std::byte*>(p) + COROUTINE_FRAME_HEADER_SIZE;
+}
+
+inline void deallocate_coroutine_frame(void* frame) noexcept
+{
+    auto* const p = static_cast<std::byte*>(frame) - COROUTINE_FRAME_HEADER_SIZE;
+    auto* const header = std::launder(reinterpret_cast<CoroutineFrameHeader*>(p));
+    const auto size = header->size_;
+    header->~CoroutineFrameHeader();
+    if AGRPC_UNLIKELY (size > LARGEST_POOL_BLOCK_SIZE)
+    {
+        detail::deallocate_already_max_aligned(p, size);
+    }
+    else if (detail::Pool::owner_of(p) == nullptr)
+    {
+        if (!detail::thread_local_coroutine_frame_cache.push(p, detail::get_pool_index(size)))
+        {
+            detail::Pool::deallocate_unmanaged_block(p, size);
+        }
+    }
+    else if (detail::thread_local_grpc_context != nullptr)
+    {
+        detail::get_local_pool_resource().deallocate(p, size);
+    }
+    else
+    {
+        detail::PoolResource::deallocate_unowned(p, size, MAX_ALIGN);
+    }
 }
 }
 
@@ -0,0 +1,255 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_GRPC_CONTEXT_POOL_HPP
+#define AGRPC_DETAIL_GRPC_CONTEXT_POOL_HPP
+
+#include <agrpc/detail/grpc_context_implementation.hpp>
+#include <agrpc/grpc_context.hpp>
+#include <agrpc/grpc_context_pool.hpp>
+#include <agrpc/grpc_executor.hpp>
+
+#include <atomic>
+#include <utility>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// Loop condition of the threads of the pool. GrpcContext::run() resets the GrpcContext, so a stop() of the pool that
+// happened before the thread started running its GrpcContext is only visible through the pool.
+struct GrpcContextPoolIsNotStopped
+{
+    [[nodiscard]] bool operator()() const noexcept { return !grpc_context_.is_stopped() && !pool_stopped_.load(); }
+
+    agrpc::GrpcContext& grpc_context_;
+    const std::atomic_bool& pool_stopped_;
+};
+
+// Wakes up an idle GrpcContext of the pool to steal the shared work of a busy one. At most one steal operation per busy
+// GrpcContext is outstanding at a time.
+struct GrpcContextPoolStealer : detail::WorkStealingHook
+{
+    GrpcContextPoolStealer() noexcept : detail::WorkStealingHook(&do_steal, &do_find_thief, &do_steal_from_others) {}
+
+    static agrpc::GrpcContext* do_find_thief(detail::WorkStealingHook& hook) noexcept
+    {
+        auto& self = static_cast<GrpcContextPoolStealer&>(hook);
+        if (self.is_steal_requested_.load(std::memory_order_relaxed) ||
+            self.is_steal_requested_.exchange(true, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        const auto size = self.pool_->size();
+        for (std::size_t i{1}; i != size; ++i)
+        {
+            auto& grpc_context = self.pool_->get_context((self.index_ + i) % size);
+            if (detail::GrpcContextImplementation::is_waiting_for_remote_work(grpc_context))
+            {
+                return &grpc_context;
+            }
+        }
+        self.is_steal_requested_.store(false, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    static void do_steal(detail::OperationBase* op, detail::OperationResult result, agrpc::GrpcContext&)
+    {
+        auto& self = *static_cast<GrpcContextPoolStealer*>(op);
+        self.is_steal_requested_.store(false, std::memory_order_relaxed);
+        if AGRPC_LIKELY (!detail::is_shutdown(result))
+        {
+            detail::GrpcContextImplementation::steal_shared_work(self.pool_->get_context(self.index_));
+        }
+    }
+
+    static bool do_steal_from_others(detail::WorkStealingHook& hook)
+    {
+        auto& self = static_cast<GrpcContextPoolStealer&>(hook);
+        const auto size = self.pool_->size();
+        for (std::size_t i{1}; i != size; ++i)
+        {
+            if (detail::GrpcContextImplementation::steal_shared_work(self.pool_->get_context((self.index_ + i) % size)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    agrpc::GrpcContextPool* pool_{};
+    std::size_t index_{};
+    std::atomic_bool is_steal_requested_{};
+};
+}
+
+inline GrpcContextPool::GrpcContextPool(std::size_t size, bool work_stealing)
+{
+    grpc_contexts_.reserve(size);
+    for (std::size_t i{}; i != size; ++i)
+    {
+        auto& grpc_context = *grpc_contexts_.emplace_back(std::make_unique<agrpc::GrpcContext>());
+        grpc_context.work_started();
+    }
+    if (work_stealing)
+    {
+        enable_work_stealing();
+    }
+}
+
+inline GrpcContextPool::GrpcContextPool(grpc::ServerBuilder& builder, std::size_t size, bool work_stealing)
+{
+    grpc_contexts_.reserve(size);
+    for (std::size_t i{}; i != size; ++i)
+    {
+        auto& grpc_context =
+            *grpc_contexts_.emplace_back(std::make_unique<agrpc::GrpcContext>(builder.AddCompletionQueue()));
+        grpc_context.work_started();
+    }
+    if (work_stealing)
+    {
+        enable_work_stealing();
+    }
+}
+
+inline GrpcContextPool::~GrpcContextPool()
+{
+    stop();
+    join();
+}
+
+inline void GrpcContextPool::start()
+{
+    threads_.reserve(grpc_contexts_.size());
+    running_threads_.store(grpc_contexts_.size(), std::memory_order_relaxed);
+    for (auto& grpc_context : grpc_contexts_)
+    {
+        threads_.emplace_back(
+            [this, &grpc_context = *grpc_context]
+            {
+                run(grpc_context);
+            });
+    }
+}
+
+inline void GrpcContextPool::stop()
+{
+    stopped_.store(true);
+    for (auto& grpc_context : grpc_contexts_)
+    {
+        grpc_context->stop();
+    }
+}
+
+inline void GrpcContextPool::join()
+{
+    if (!std::exchange(joined_, true))
+    {
+        for (auto& grpc_context : grpc_contexts_)
+        {
+            grpc_context->work_finished();
+        }
+    }
+    for (auto& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+inline std::size_t GrpcContextPool::size() const noexcept { return grpc_contexts_.size(); }
+
+inline agrpc::GrpcContext& GrpcContextPool::get_context(std::size_t index) noexcept { return *grpc_contexts_[index]; }
+
+inline agrpc::GrpcContext& GrpcContextPool::next_context() noexcept
+{
+    return *grpc_contexts_[next_.fetch_add(1, std::memory_order_relaxed) % grpc_contexts_.size()];
+}
+
+inline agrpc::GrpcContext& GrpcContextPool::least_loaded_context() noexcept
+{
+    // Start at a rotating offset so that ties are broken in round-robin order
+    const auto size = grpc_contexts_.size();
+    const auto offset = next_.fetch_add(1, std::memory_order_relaxed);
+    auto* result = grpc_contexts_[offset % size].get();
+    auto least_work = detail::GrpcContextImplementation::outstanding_work(*result);
+    for (std::size_t i{1}; i != size && least_work != 0; ++i)
+    {
+        auto* grpc_context = grpc_contexts_[(offset + i) % size].get();
+        if (const auto work = detail::GrpcContextImplementation::outstanding_work(*grpc_context); work < least_work)
+        {
+            result = grpc_context;
+            least_work = work;
+        }
+    }
+    return *result;
+}
+
+inline GrpcContextPool::executor_type GrpcContextPool::get_executor() noexcept
+{
+    return next_context().get_executor();
+}
+
+inline GrpcContextPool::executor_type GrpcContextPool::get_least_loaded_executor() noexcept
+{
+    return least_loaded_context().get_executor();
+}
+
+inline void GrpcContextPool::run(agrpc::GrpcContext& grpc_context)
+{
+    // GrpcContext::run() would reset a stop() that happened before this thread got to run its GrpcContext
+    const detail::GrpcContextLoopCondition loop_condition{detail::GrpcContextPoolIsNotStopped{grpc_context, stopped_}};
+    detail::GrpcContextImplementation::process_work(grpc_context, loop_condition,
+                                                    detail::GrpcContextImplementation::INFINITE_FUTURE);
+    if (!stealers_)
+    {
+        return;
+    }
+    // The GrpcContext ran out of work after join(). Keep it alive so that its thread can steal the work of the other
+    // GrpcContexts until all of them ran out of work. The last thread to get here lets all GrpcContexts finish.
+    grpc_context.work_started();
+    if (1 == running_threads_.fetch_sub(1, std::memory_order_acq_rel))
+    {
+        for (auto& context : grpc_contexts_)
+        {
+            context->work_finished();
+        }
+    }
+    if (!stopped_.load())
+    {
+        detail::GrpcContextImplementation::process_work(grpc_context, loop_condition,
+                                                        detail::GrpcContextImplementation::INFINITE_FUTURE);
+    }
+}
+
+inline void GrpcContextPool::enable_work_stealing()
+{
+    const auto size = grpc_contexts_.size();
+    stealers_ = std::make_unique<detail::GrpcContextPoolStealer[]>(size);
+    for (std::size_t i{}; i != size; ++i)
+    {
+        auto& stealer = stealers_[i];
+        stealer.pool_ = this;
+        stealer.index_ = i;
+        detail::GrpcContextImplementation::set_work_stealing_hook(*grpc_contexts_[i], stealer);
+    }
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_GRPC_CONTEXT_POOL_HPP
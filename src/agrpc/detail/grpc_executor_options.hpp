@@ -27,6 +27,7 @@ struct GrpcExecutorOptions
 {
     static constexpr std::uint32_t BLOCKING_NEVER = 1u << 0u;
     static constexpr std::uint32_t OUTSTANDING_WORK_TRACKED = 1u << 1u;
+    static constexpr std::uint32_t HIGH_PRIORITY = 1u << 2u;
 
     static constexpr std::uint32_t DEFAULT = BLOCKING_NEVER;
 
@@ -71,6 +72,24 @@ struct GrpcExecutorOptions
     }
     return options;
 }
+
+[[nodiscard]] constexpr bool is_high_priority(std::uint32_t options) noexcept
+{
+    return (options & detail::GrpcExecutorOptions::HIGH_PRIORITY) != 0u;
+}
+
+[[nodiscard]] constexpr std::uint32_t set_high_priority(std::uint32_t options, bool value) noexcept
+{
+    if (value)
+    {
+        options |= detail::GrpcExecutorOptions::HIGH_PRIORITY;
+    }
+    else
+    {
+        options &= ~detail::GrpcExecutorOptions::HIGH_PRIORITY;
+    }
+    return options;
+}
 }
 
 AGRPC_NAMESPACE_END
@@ -16,6 +16,7 @@
 #define AGRPC_DETAIL_INITIATE_SENDER_IMPLEMENTATION_HPP
 
 #include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/operation_slot.hpp>
 #include <agrpc/detail/use_sender.hpp>
 #include <agrpc/grpc_executor.hpp>
 #include <agrpc/use_sender.hpp>
@@ -48,6 +49,25 @@ struct SubmitSenderImplementationOperation
 
     agrpc::GrpcContext& grpc_context_;
 };
+
+struct SubmitSenderImplementationOperationInSlot
+{
+    using executor_type = agrpc::GrpcExecutor;
+
+    template <class CompletionHandler, class Initiation, class Implementation>
+    void operator()(CompletionHandler&& completion_handler, const Initiation& initiation,
+                    Implementation&& implementation)
+    {
+        detail::submit_sender_implementation_operation(grpc_context_, slot_,
+                                                       static_cast<CompletionHandler&&>(completion_handler), initiation,
+                                                       static_cast<Implementation&&>(implementation));
+    }
+
+    [[nodiscard]] executor_type get_executor() const noexcept { return grpc_context_.get_executor(); }
+
+    agrpc::GrpcContext& grpc_context_;
+    detail::OperationSlot& slot_;
+};
 #endif
 
 template <class Initiation, class Implementation, class CompletionToken>
@@ -68,6 +88,28 @@ auto async_initiate_sender_implementation(agrpc::GrpcContext& grpc_context, cons
             grpc_context, initiation, static_cast<Implementation&&>(implementation));
     }
 }
+
+// Operations initiated with an Asio completion token are constructed in the slot when possible. Senders already store
+// the operation state in the object returned by `connect`.
+template <class Initiation, class Implementation, class CompletionToken>
+auto async_initiate_sender_implementation(agrpc::GrpcContext& grpc_context,
+                                          [[maybe_unused]] detail::OperationSlot& slot, const Initiation& initiation,
+                                          Implementation&& implementation, [[maybe_unused]] CompletionToken&& token)
+{
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+    if constexpr (!detail::IS_USE_SENDER<CompletionToken>)
+    {
+        return asio::async_initiate<CompletionToken, typename Implementation::Signature>(
+            detail::SubmitSenderImplementationOperationInSlot{grpc_context, slot}, token, initiation,
+            static_cast<Implementation&&>(implementation));
+    }
+    else
+#endif
+    {
+        return detail::BasicSenderAccess::create<Initiation, Implementation>(
+            grpc_context, initiation, static_cast<Implementation&&>(implementation));
+    }
+}
 }
 
 AGRPC_NAMESPACE_END
@@ -17,6 +17,9 @@
 
 #include <agrpc/detail/pool_resource.hpp>
 
+#include <atomic>
+#include <cstdint>
+
 #include <agrpc/detail/config.hpp>
 
 AGRPC_NAMESPACE_BEGIN()
@@ -25,9 +28,54 @@ namespace detail
 {
 struct ListablePoolResource
 {
-    ListablePoolResource* next_;
+    ListablePoolResource* next_created_;
     detail::PoolResource resource_;
+
+    // The value of GrpcContext::memory_resources_trim_epoch_ when this resource was trimmed last
+    std::uint64_t trim_epoch_;
+
+    // Set while a thread runs the GrpcContext with this resource
+    std::atomic_bool in_use_;
 };
+
+inline ListablePoolResource& create_resource(ListablePoolResource*& created_resources,
+                                             const std::atomic_size_t& largest_pooled_block_size)
+{
+    auto* const resource =
+        new ListablePoolResource{created_resources, detail::PoolResource{largest_pooled_block_size}, {}, {}};
+    created_resources = resource;
+    return *resource;
+}
+
+[[nodiscard]] inline bool try_acquire_resource(ListablePoolResource& resource) noexcept
+{
+    bool expected{};
+    return resource.in_use_.compare_exchange_strong(expected, true, std::memory_order_acquire,
+                                                    std::memory_order_relaxed);
+}
+
+inline void release_resource(ListablePoolResource& resource) noexcept
+{
+    resource.in_use_.store(false, std::memory_order_release);
+}
+
+// The resource that the current thread used last, tried first the next time that this thread runs the same
+// GrpcContext. It is only a hint: the resource remains owned by its GrpcContext, which is identified by a process-wide
+// unique id rather than its address to rule out mixing it up with a later GrpcContext at the same address. Entries of
+// destroyed GrpcContexts are therefore never dereferenced and simply overwritten.
+struct ThreadCachedPoolResource
+{
+    std::uint64_t owner_id_{};
+    ListablePoolResource* resource_{};
+};
+
+inline thread_local detail::ThreadCachedPoolResource thread_cached_pool_resource{};
+
+inline std::uint64_t next_pool_resource_owner_id() noexcept
+{
+    static std::atomic_uint64_t id{};
+    return id.fetch_add(1, std::memory_order_relaxed) + 1;
+}
 }
 
 AGRPC_NAMESPACE_END
@@ -26,6 +26,10 @@ namespace detail
 {
 inline constexpr auto MAX_ALIGN = alignof(std::max_align_t);
 
+// Used to keep atomics that are modified by different threads on separate cache lines. Not based on
+// std::hardware_destructive_interference_size because its value may differ between translation units.
+inline constexpr std::size_t CACHE_LINE_SIZE = 64;
+
 struct MaxAlignedData
 {
     alignas(std::max_align_t) std::byte data_[MAX_ALIGN];
@@ -35,6 +35,11 @@ void initiate(Operation& operation, agrpc::GrpcContext& grpc_context, const Init
             initiation.initiate(OperationHandle<Operation, AllocationType::LOCAL>{operation, grpc_context},
                                 operation.implementation());
         }
+        else if (AllocationType::SLOT == alloc_type)
+        {
+            initiation.initiate(OperationHandle<Operation, AllocationType::SLOT>{operation, grpc_context},
+                                operation.implementation());
+        }
         else
         {
             initiation.initiate(OperationHandle<Operation, AllocationType::CUSTOM>{operation, grpc_context},
@@ -0,0 +1,129 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_OPERATION_SLOT_HPP
+#define AGRPC_DETAIL_OPERATION_SLOT_HPP
+
+#include <cstddef>
+#include <new>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// In-object storage for one outstanding operation of an rpc. gRPC allows at most one outstanding read and one
+// outstanding write per stream, which lets a streaming rpc reuse the same storage for every message. Operations that
+// do not fit or that find the slot occupied are allocated as usual.
+class OperationSlot
+{
+  public:
+    // Large enough for the operations of asio::awaitable, asio::yield_context and agrpc::Task
+    static constexpr std::size_t SIZE = 160;
+
+    template <class T>
+    static constexpr bool FITS = sizeof(T) <= SIZE && alignof(T) <= alignof(std::max_align_t);
+
+    OperationSlot() = default;
+
+    OperationSlot(const OperationSlot&) = delete;
+    OperationSlot(OperationSlot&&) = delete;
+    OperationSlot& operator=(const OperationSlot&) = delete;
+    OperationSlot& operator=(OperationSlot&&) = delete;
+
+    [[nodiscard]] void* try_acquire() noexcept
+    {
+        if (in_use_)
+        {
+            return nullptr;
+        }
+        in_use_ = true;
+        return storage_;
+    }
+
+    void release() noexcept { in_use_ = false; }
+
+    // The storage is the first member, an object that lives in the slot therefore has the address of the slot
+    static OperationSlot& from_storage(void* storage) noexcept
+    {
+        return *std::launder(reinterpret_cast<OperationSlot*>(storage));
+    }
+
+  private:
+    alignas(std::max_align_t) std::byte storage_[SIZE];
+    bool in_use_{};
+};
+
+// Used by operations that live in an OperationSlot to destroy themselves, deallocation releases the slot
+template <class T>
+class OperationSlotAllocator
+{
+  public:
+    using value_type = T;
+
+    OperationSlotAllocator() = default;
+
+    template <class U>
+    constexpr OperationSlotAllocator(const OperationSlotAllocator<U>&) noexcept
+    {
+    }
+
+    [[nodiscard]] static T* allocate(std::size_t) noexcept { return nullptr; }
+
+    static void deallocate(T* p, std::size_t) noexcept { OperationSlot::from_storage(p).release(); }
+
+    friend constexpr bool operator==(const OperationSlotAllocator&, const OperationSlotAllocator&) noexcept
+    {
+        return true;
+    }
+
+    friend constexpr bool operator!=(const OperationSlotAllocator&, const OperationSlotAllocator&) noexcept
+    {
+        return false;
+    }
+};
+
+// Base of client-streaming and server-streaming rpcs, whose operations may not be outstanding at the same time
+class RPCOperationSlot
+{
+  protected:
+    RPCOperationSlot() = default;
+
+    [[nodiscard]] detail::OperationSlot& operation_slot() noexcept { return slot_; }
+
+  private:
+    detail::OperationSlot slot_;
+};
+
+// Base of bidirectional-streaming rpcs. Reads use the read slot. Writes, writes_done and finish share the write slot
+// since gRPC does not allow them to be outstanding at the same time.
+class BidiRPCOperationSlots
+{
+  protected:
+    BidiRPCOperationSlots() = default;
+
+    [[nodiscard]] detail::OperationSlot& read_slot() noexcept { return read_slot_; }
+
+    [[nodiscard]] detail::OperationSlot& write_slot() noexcept { return write_slot_; }
+
+  private:
+    detail::OperationSlot read_slot_;
+    detail::OperationSlot write_slot_;
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_OPERATION_SLOT_HPP
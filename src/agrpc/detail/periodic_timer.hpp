@@ -0,0 +1,312 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_PERIODIC_TIMER_HPP
+#define AGRPC_DETAIL_PERIODIC_TIMER_HPP
+
+#include <agrpc/detail/alarm.hpp>
+#include <agrpc/detail/allocate.hpp>
+#include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/association.hpp>
+#include <agrpc/detail/bind_allocator.hpp>
+#include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/grpc_sender.hpp>
+#include <agrpc/detail/use_sender.hpp>
+#include <agrpc/detail/utility.hpp>
+#include <agrpc/grpc_executor.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <agrpc/detail/config.hpp>
+
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+#include <agrpc/detail/sender_implementation_operation.hpp>
+#endif
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// Owned jointly by the BasicPeriodicTimer, its outstanding wait and the operation that occupies the reusable memory
+// block, so that destroying the timer before the wait completes is safe.
+class PeriodicTimerState
+{
+  public:
+    using Clock = std::chrono::system_clock;
+
+    PeriodicTimerState(Clock::time_point expiry, Clock::duration period) noexcept : expiry_(expiry), period_(period) {}
+
+    PeriodicTimerState(const PeriodicTimerState&) = delete;
+    PeriodicTimerState(PeriodicTimerState&&) = delete;
+    PeriodicTimerState& operator=(const PeriodicTimerState&) = delete;
+    PeriodicTimerState& operator=(PeriodicTimerState&&) = delete;
+
+    ~PeriodicTimerState() noexcept { ::operator delete(buffer_); }
+
+    void acquire() noexcept { reference_count_.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept
+    {
+        if (1 == reference_count_.fetch_sub(1, std::memory_order_acq_rel))
+        {
+            delete this;
+        }
+    }
+
+    // Moves the expiry past `now` by a whole number of periods, so that expiries do not drift regardless of how late
+    // the completion is observed. Returns the number of skipped expiries.
+    std::size_t advance(Clock::time_point now) noexcept
+    {
+        std::size_t missed_ticks{};
+        if (now >= expiry_)
+        {
+            missed_ticks = static_cast<std::size_t>((now - expiry_) / period_);
+        }
+        expiry_ += period_ * static_cast<Clock::rep>(missed_ticks + 1);
+        return missed_ticks;
+    }
+
+    // A second allocation while the memory block is in use, e.g. due to nested allocations, falls back to the global
+    // heap.
+    [[nodiscard]] void* allocate(std::size_t size)
+    {
+        if AGRPC_UNLIKELY (is_buffer_in_use_)
+        {
+            return ::operator new(size);
+        }
+        if AGRPC_UNLIKELY (size > buffer_size_)
+        {
+            ::operator delete(buffer_);
+            buffer_ = nullptr;
+            buffer_size_ = 0;
+            buffer_ = ::operator new(size);
+            buffer_size_ = size;
+        }
+        is_buffer_in_use_ = true;
+        acquire();
+        return buffer_;
+    }
+
+    void deallocate(void* p) noexcept
+    {
+        if AGRPC_LIKELY (p == buffer_)
+        {
+            is_buffer_in_use_ = false;
+            release();
+            return;
+        }
+        ::operator delete(p);
+    }
+
+    Clock::time_point expiry_;
+    Clock::duration period_;
+
+  private:
+    std::atomic_uint32_t reference_count_{1};
+    void* buffer_{};
+    std::size_t buffer_size_{};
+    bool is_buffer_in_use_{};
+};
+
+class PeriodicTimerStatePtr
+{
+  public:
+    explicit PeriodicTimerStatePtr(detail::PeriodicTimerState* state) noexcept : state_(state) {}
+
+    PeriodicTimerStatePtr(const PeriodicTimerStatePtr& other) noexcept : state_(other.state_) { state_->acquire(); }
+
+    PeriodicTimerStatePtr(PeriodicTimerStatePtr&& other) noexcept : state_(std::exchange(other.state_, nullptr)) {}
+
+    ~PeriodicTimerStatePtr() noexcept
+    {
+        if (state_)
+        {
+            state_->release();
+        }
+    }
+
+    PeriodicTimerStatePtr& operator=(const PeriodicTimerStatePtr&) = delete;
+    PeriodicTimerStatePtr& operator=(PeriodicTimerStatePtr&&) = delete;
+
+    detail::PeriodicTimerState* operator->() const noexcept { return state_; }
+
+    detail::PeriodicTimerState& operator*() const noexcept { return *state_; }
+
+  private:
+    detail::PeriodicTimerState* state_;
+};
+
+template <class T>
+class PeriodicTimerAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit PeriodicTimerAllocator(detail::PeriodicTimerState& state) noexcept : state_(&state) {}
+
+    template <class U>
+    PeriodicTimerAllocator(const detail::PeriodicTimerAllocator<U>& other) noexcept : state_(other.state_)
+    {
+    }
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return std::allocator<T>{}.allocate(n);
+        }
+        else
+        {
+            return static_cast<T*>(state_->allocate(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+        else
+        {
+            state_->deallocate(p);
+        }
+    }
+
+    template <class U>
+    friend bool operator==(const PeriodicTimerAllocator& lhs, const detail::PeriodicTimerAllocator<U>& rhs) noexcept
+    {
+        return lhs.state_ == rhs.state_;
+    }
+
+    template <class U>
+    friend bool operator!=(const PeriodicTimerAllocator& lhs, const detail::PeriodicTimerAllocator<U>& rhs) noexcept
+    {
+        return lhs.state_ != rhs.state_;
+    }
+
+  private:
+    template <class>
+    friend class detail::PeriodicTimerAllocator;
+
+    detail::PeriodicTimerState* state_;
+};
+
+struct PeriodicTimerSenderImplementation
+{
+    static constexpr bool NEEDS_ON_COMPLETE = true;
+
+    using BaseType = detail::GrpcTagOperationBase;
+    using Signature = void(bool, std::size_t);
+    using StopFunction = detail::AlarmCancellationFunction;
+
+    template <class OnComplete>
+    void complete(OnComplete on_complete, bool ok)
+    {
+        if (ok)
+        {
+            on_complete(true, state_->advance(PeriodicTimerState::Clock::now()));
+        }
+        else
+        {
+            on_complete(false, std::size_t{});
+        }
+    }
+
+    detail::PeriodicTimerStatePtr state_;
+};
+
+struct SenderPeriodicTimerSenderImplementation : detail::PeriodicTimerSenderImplementation
+{
+    using Signature = void(std::size_t);
+
+    template <class OnComplete>
+    void complete(OnComplete on_complete, bool ok)
+    {
+        if (ok)
+        {
+            on_complete(state_->advance(PeriodicTimerState::Clock::now()));
+        }
+        else
+        {
+            on_complete.done();
+        }
+    }
+};
+
+using PeriodicTimerInitiation =
+    detail::GrpcSenderInitiation<detail::AlarmInitFunction<detail::PeriodicTimerState::Clock::time_point>>;
+
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+struct SubmitPeriodicTimerOperation
+{
+    using executor_type = agrpc::GrpcExecutor;
+
+    template <class CompletionHandler>
+    void operator()(CompletionHandler&& completion_handler, const detail::PeriodicTimerInitiation& initiation,
+                    detail::PeriodicTimerSenderImplementation implementation)
+    {
+        using Allocator = assoc::associated_allocator_t<detail::RemoveCrefT<CompletionHandler>>;
+        if constexpr (detail::IS_STD_ALLOCATOR<Allocator>)
+        {
+            detail::submit_sender_implementation_operation(
+                grpc_context_,
+                detail::AllocatorBinder(detail::PeriodicTimerAllocator<std::byte>{*implementation.state_},
+                                        static_cast<CompletionHandler&&>(completion_handler)),
+                initiation, static_cast<detail::PeriodicTimerSenderImplementation&&>(implementation));
+        }
+        else
+        {
+            detail::submit_sender_implementation_operation(
+                grpc_context_, static_cast<CompletionHandler&&>(completion_handler), initiation,
+                static_cast<detail::PeriodicTimerSenderImplementation&&>(implementation));
+        }
+    }
+
+    [[nodiscard]] executor_type get_executor() const noexcept { return grpc_context_.get_executor(); }
+
+    agrpc::GrpcContext& grpc_context_;
+};
+#endif
+
+template <class CompletionToken>
+auto async_initiate_periodic_timer_wait(agrpc::GrpcContext& grpc_context,
+                                        const detail::PeriodicTimerInitiation& initiation,
+                                        const detail::PeriodicTimerStatePtr& state,
+                                        [[maybe_unused]] CompletionToken&& token)
+{
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+    if constexpr (!detail::IS_USE_SENDER<CompletionToken>)
+    {
+        return asio::async_initiate<CompletionToken, detail::PeriodicTimerSenderImplementation::Signature>(
+            detail::SubmitPeriodicTimerOperation{grpc_context}, token, initiation,
+            detail::PeriodicTimerSenderImplementation{state});
+    }
+    else
+#endif
+    {
+        return detail::BasicSenderAccess::create(grpc_context, initiation,
+                                                 detail::SenderPeriodicTimerSenderImplementation{{state}});
+    }
+}
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_PERIODIC_TIMER_HPP
@@ -19,7 +19,10 @@
 #include <agrpc/detail/math.hpp>
 #include <agrpc/detail/memory.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <new>
 
 #include <agrpc/detail/config.hpp>
 
@@ -44,9 +47,11 @@ class MemoryBlockSlist
     static constexpr std::size_t HEADER_SIZE = detail::align(sizeof(Header), MAX_ALIGN);
 
   public:
+    [[nodiscard]] static constexpr std::size_t allocation_size(std::size_t size) noexcept { return size + HEADER_SIZE; }
+
     [[nodiscard]] void* allocate_already_max_aligned(std::size_t size)
     {
-        const auto allocation_size = size + HEADER_SIZE;
+        const auto allocation_size = MemoryBlockSlist::allocation_size(size);
         void* p = detail::allocate_already_max_aligned(allocation_size);
         auto* const header = ::new (p) Header;
         header->size_ = allocation_size;
@@ -54,6 +59,39 @@ class MemoryBlockSlist
         return static_cast<char*>(p) + HEADER_SIZE;
     }
 
+    // Deallocates every memory block for which `predicate(data, size)` returns true and returns the total size of the
+    // deallocated memory including headers
+    template <class Predicate>
+    std::size_t release_already_max_aligned_if(Predicate predicate) noexcept
+    {
+        std::size_t released_size{};
+        List kept;
+        for (auto it = slist_.begin(); it != slist_.end();)
+        {
+            auto& header = *it;
+            ++it;
+            const auto size = header.size_;
+            if (predicate(reinterpret_cast<char*>(&header) + HEADER_SIZE, size - HEADER_SIZE))
+            {
+                header.~Header();
+                detail::deallocate_already_max_aligned(&header, size);
+                released_size += size;
+            }
+            else
+            {
+                kept.push_front(&header);
+            }
+        }
+        slist_.clear();
+        for (auto it = kept.begin(); it != kept.end();)
+        {
+            auto& header = *it;
+            ++it;
+            slist_.push_front(&header);
+        }
+        return released_size;
+    }
+
     void release_already_max_aligned() noexcept
     {
         for (auto it = slist_.begin(); it != slist_.end();)
@@ -71,6 +109,21 @@ class MemoryBlockSlist
     List slist_;
 };
 
+class PoolResource;
+
+// Counters that are only modified by the thread that currently uses the resource but that may be read by any thread
+template <class T>
+void single_writer_add(std::atomic<T>& counter, T value) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+template <class T>
+void single_writer_subtract(std::atomic<T>& counter, T value) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) - value, std::memory_order_relaxed);
+}
+
 class Pool
 {
   private:
@@ -83,13 +136,17 @@ class Pool
 
     struct Header
     {
-        bool unmanaged_{};
+        // The resource whose chunk contains the block, nullptr for unmanaged blocks
+        detail::PoolResource* owner_{};
     };
 
     static constexpr std::size_t HEADER_SIZE = detail::align(sizeof(Header), MAX_ALIGN);
     static constexpr std::size_t MINIMUM_MAX_BLOCKS_PER_CHUNK = 1u;
     static constexpr std::size_t MAX_BLOCKS_PER_CHUNK = 32u;
 
+    // Chunks double in size, starting at MINIMUM_MAX_BLOCKS_PER_CHUNK, until this many blocks have been reserved
+    static constexpr std::size_t MAX_RESERVED_BLOCKS = MAX_BLOCKS_PER_CHUNK - 1u;
+
   public:
     [[nodiscard]] void* allocate_block() noexcept
     {
@@ -99,6 +156,7 @@ class Pool
         }
         auto* pv = free_list_.pop_front();
         pv->~FreeListEntry();
+        detail::single_writer_add(used_blocks_, std::size_t{1});
         return pv;
     }
 
@@ -106,26 +164,26 @@ class Pool
     {
         const auto allocation_size = block_size + HEADER_SIZE;
         void* p = detail::allocate_already_max_aligned(allocation_size);
-        auto* const header = ::new (p) Header;
-        header->unmanaged_ = true;
+        ::new (p) Header;
         return static_cast<char*>(p) + HEADER_SIZE;
     }
 
-    [[nodiscard]] bool max_size_reached() const noexcept { return next_blocks_per_chunk_ == MAX_BLOCKS_PER_CHUNK; }
+    [[nodiscard]] bool max_size_reached() const noexcept { return reserved_blocks_ >= MAX_RESERVED_BLOCKS; }
+
+    [[nodiscard]] static detail::PoolResource* owner_of(void* p) noexcept { return header_of(p)->owner_; }
 
-    void deallocate_block(void* p, std::size_t block_size) noexcept
+    static void deallocate_unmanaged_block(void* p, std::size_t block_size) noexcept
     {
-        auto* const header = reinterpret_cast<Header*>(static_cast<char*>(p) - HEADER_SIZE);
-        if (header->unmanaged_)
-        {
-            header->~Header();
-            detail::deallocate_already_max_aligned(header, block_size + HEADER_SIZE);
-        }
-        else
-        {
-            auto* const pv = ::new (p) FreeListEntry;
-            free_list_.push_front(pv);
-        }
+        auto* const header = header_of(p);
+        header->~Header();
+        detail::deallocate_already_max_aligned(header, block_size + HEADER_SIZE);
+    }
+
+    void push_block(void* p) noexcept
+    {
+        auto* const pv = ::new (p) FreeListEntry;
+        free_list_.push_front(pv);
+        detail::single_writer_subtract(used_blocks_, std::size_t{1});
     }
 
     void release() noexcept
@@ -133,32 +191,117 @@ class Pool
         free_list_.clear();
         chunks_.release_already_max_aligned();
         next_blocks_per_chunk_ = MINIMUM_MAX_BLOCKS_PER_CHUNK;
+        reserved_blocks_ = 0;
+        reserved_bytes_.store(0, std::memory_order_relaxed);
+        used_blocks_.store(0, std::memory_order_relaxed);
     }
 
-    void replenish(std::size_t block_size)
+    void replenish(std::size_t block_size, detail::PoolResource* owner)
     {
-        const auto blocks_per_chunk = next_blocks_per_chunk_;
+        const auto blocks_per_chunk = detail::minimum(next_blocks_per_chunk_, MAX_RESERVED_BLOCKS - reserved_blocks_);
+        const auto allocation_size = blocks_per_chunk * block_size + blocks_per_chunk * HEADER_SIZE;
 
         // Minimum block size is at least max_align, so all pools allocate sizes that are multiple of max_align,
         // meaning that all blocks are max_align-aligned.
-        auto* p = static_cast<char*>(
-            chunks_.allocate_already_max_aligned(blocks_per_chunk * block_size + blocks_per_chunk * HEADER_SIZE));
+        auto* p = static_cast<char*>(chunks_.allocate_already_max_aligned(allocation_size));
 
         for (std::size_t i{}; i != blocks_per_chunk; ++i)
         {
-            ::new (static_cast<void*>(p)) Header{};
+            ::new (static_cast<void*>(p)) Header{owner};
             auto* const pv = ::new (static_cast<void*>(p + HEADER_SIZE)) FreeListEntry;
             free_list_.push_front(pv);
             p += block_size + HEADER_SIZE;
         }
 
-        next_blocks_per_chunk_ = blocks_per_chunk * 2u;
+        next_blocks_per_chunk_ = detail::minimum(next_blocks_per_chunk_ * 2u, MAX_BLOCKS_PER_CHUNK);
+        reserved_blocks_ += blocks_per_chunk;
+        detail::single_writer_add(reserved_bytes_, MemoryBlockSlist::allocation_size(allocation_size));
     }
 
+    // Deallocates all chunks whose blocks are all in the free list
+    void trim(std::size_t block_size) noexcept
+    {
+        if (reserved_blocks_ == 0)
+        {
+            return;
+        }
+        if (used_blocks_.load(std::memory_order_relaxed) == 0)
+        {
+            release();
+            return;
+        }
+        const auto block_stride = block_size + HEADER_SIZE;
+        const auto released_bytes = chunks_.release_already_max_aligned_if(
+            [&](char* chunk, std::size_t chunk_size)
+            {
+                const auto is_in_chunk = [&](FreeListEntry& entry)
+                {
+                    auto* const p = reinterpret_cast<char*>(&entry);
+                    return p >= chunk && p < chunk + chunk_size;
+                };
+                const auto block_count = chunk_size / block_stride;
+                std::size_t free_block_count{};
+                for (auto& entry : free_list_)
+                {
+                    free_block_count += is_in_chunk(entry) ? 1u : 0u;
+                }
+                if (free_block_count != block_count)
+                {
+                    return false;
+                }
+                remove_from_free_list_if(is_in_chunk);
+                reserved_blocks_ -= block_count;
+                return true;
+            });
+        detail::single_writer_subtract(reserved_bytes_, released_bytes);
+    }
+
+    [[nodiscard]] std::size_t reserved_bytes() const noexcept
+    {
+        return reserved_bytes_.load(std::memory_order_relaxed);
+    }
+
+    // Includes blocks that have been deallocated through another resource but that were not reclaimed yet
+    [[nodiscard]] std::size_t used_blocks() const noexcept { return used_blocks_.load(std::memory_order_relaxed); }
+
   private:
+    static Header* header_of(void* p) noexcept
+    {
+        return reinterpret_cast<Header*>(static_cast<char*>(p) - HEADER_SIZE);
+    }
+
+    template <class Predicate>
+    void remove_from_free_list_if(Predicate predicate) noexcept
+    {
+        FreeList kept;
+        for (auto it = free_list_.begin(); it != free_list_.end();)
+        {
+            auto& entry = *it;
+            ++it;
+            if (predicate(entry))
+            {
+                entry.~FreeListEntry();
+            }
+            else
+            {
+                kept.push_front(&entry);
+            }
+        }
+        free_list_.clear();
+        for (auto it = kept.begin(); it != kept.end();)
+        {
+            auto& entry = *it;
+            ++it;
+            free_list_.push_front(&entry);
+        }
+    }
+
     MemoryBlockSlist chunks_;
     FreeList free_list_;
     std::size_t next_blocks_per_chunk_{MINIMUM_MAX_BLOCKS_PER_CHUNK};
+    std::size_t reserved_blocks_{};
+    std::atomic_size_t reserved_bytes_{};
+    std::atomic_size_t used_blocks_{};
 };
 
 inline constexpr std::size_t MINIMUM_POOL_BLOCK_SIZE = MAX_ALIGN > sizeof(void*)
@@ -169,6 +312,10 @@ inline constexpr std::size_t SMALLEST_POOL_BLOCK_SIZE =
     detail::align(DESIRED_SMALLEST_POOL_BLOCK_SIZE, MINIMUM_POOL_BLOCK_SIZE);
 inline constexpr std::size_t SMALLEST_POOL_BLOCK_SIZE_LOG2 = detail::ceil_log2(SMALLEST_POOL_BLOCK_SIZE);
 inline constexpr std::size_t LARGEST_POOL_BLOCK_SIZE =
+    SMALLEST_POOL_BLOCK_SIZE > 65536u ? SMALLEST_POOL_BLOCK_SIZE : 65536u;
+
+// Size classes above this are served by the global heap unless configured otherwise
+inline constexpr std::size_t DEFAULT_LARGEST_POOLED_BLOCK_SIZE =
     SMALLEST_POOL_BLOCK_SIZE > 1024u ? SMALLEST_POOL_BLOCK_SIZE : 1024u;
 
 constexpr std::size_t get_pool_index(std::size_t size) noexcept
@@ -183,10 +330,46 @@ constexpr std::size_t get_block_size_of_pool_at(std::size_t index) noexcept
     return SMALLEST_POOL_BLOCK_SIZE << index;
 }
 
+inline constexpr std::size_t POOL_COUNT = detail::get_pool_index(LARGEST_POOL_BLOCK_SIZE) + 1u;
+
+// Allocations that are larger aligned than std::max_align_t are placed within a larger block
+constexpr std::size_t get_pool_allocation_size(std::size_t size, std::size_t alignment) noexcept
+{
+    return alignment > MAX_ALIGN ? size + alignment : size;
+}
+
+constexpr std::size_t round_to_pool_block_size(std::size_t size) noexcept
+{
+    return detail::get_block_size_of_pool_at(detail::get_pool_index(detail::minimum(size, LARGEST_POOL_BLOCK_SIZE)));
+}
+
+struct PoolStatistics
+{
+    std::size_t block_size;
+    std::size_t reserved_bytes;
+    std::size_t used_bytes;
+};
+
+struct PoolResourceStatistics
+{
+    std::uint64_t local_deallocations;
+    std::uint64_t remote_deallocations;
+    std::uint64_t remote_frees;
+    PoolStatistics pools[POOL_COUNT];
+};
+
+// Blocks remember the resource that allocated them. A block that is deallocated through another resource, e.g. because
+// a multithreaded GrpcContext completed the operation on a different thread, is handed back to its owner through a
+// lock-free list, similar to mimalloc's thread-delayed free list. The owner drains that list once one of its pools runs
+// empty.
 class PoolResource
 {
   public:
-    PoolResource() = default;
+    // Blocks of size classes above `largest_pooled_block_size` are allocated individually from the global heap
+    explicit PoolResource(const std::atomic_size_t& largest_pooled_block_size) noexcept
+        : largest_pooled_block_size_(largest_pooled_block_size)
+    {
+    }
 
     ~PoolResource() noexcept { release(); }
 
@@ -203,38 +386,199 @@ class PoolResource
         void* p = pool.allocate_block();
         if (p == nullptr)
         {
+            if (remote_free_list_.load(std::memory_order_relaxed) != nullptr)
+            {
+                drain_remote_free_list();
+                p = pool.allocate_block();
+                if (p != nullptr)
+                {
+                    return p;
+                }
+            }
             const auto block_size = detail::get_block_size_of_pool_at(pool_idx);
-            if (pool.max_size_reached())
+            if (pool.max_size_reached() ||
+                block_size > largest_pooled_block_size_.load(std::memory_order_relaxed))
             {
-                p = pool.allocate_unmanaged_block(block_size);
+                p = Pool::allocate_unmanaged_block(detail::align(size, MAX_ALIGN));
             }
             else
             {
-                pool.replenish(block_size);
+                pool.replenish(block_size, this);
                 p = pool.allocate_block();
             }
         }
         return p;
     }
 
+    // Cannot handle allocations for which get_pool_allocation_size() is larger than LARGEST_POOL_BLOCK_SIZE
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment)
+    {
+        if (alignment <= MAX_ALIGN)
+        {
+            return allocate(size);
+        }
+        return align_block(allocate(size + alignment), alignment);
+    }
+
     void deallocate(void* p, std::size_t size)
     {
         const auto pool_idx = detail::get_pool_index(size);
-        pools_[pool_idx].deallocate_block(p, detail::get_block_size_of_pool_at(pool_idx));
+        auto* const owner = Pool::owner_of(p);
+        if AGRPC_LIKELY (owner == this)
+        {
+            pools_[pool_idx].push_block(p);
+            detail::single_writer_add(statistics_.local_deallocations_, std::uint64_t{1});
+        }
+        else if (owner == nullptr)
+        {
+            Pool::deallocate_unmanaged_block(p, detail::align(size, MAX_ALIGN));
+        }
+        else
+        {
+            owner->push_remote_block(p, pool_idx);
+            detail::single_writer_add(statistics_.remote_deallocations_, std::uint64_t{1});
+        }
+    }
+
+    void deallocate(void* p, std::size_t size, std::size_t alignment)
+    {
+        if (alignment <= MAX_ALIGN)
+        {
+            deallocate(p, size);
+            return;
+        }
+        deallocate(block_of(p), size + alignment);
+    }
+
+    // For threads that do not run a GrpcContext. The memory can be deallocated by any PoolResource.
+    [[nodiscard]] static void* allocate_unowned(std::size_t size, std::size_t alignment)
+    {
+        if (alignment <= MAX_ALIGN)
+        {
+            return Pool::allocate_unmanaged_block(detail::align(size, MAX_ALIGN));
+        }
+        return align_block(allocate_unowned(size + alignment, MAX_ALIGN), alignment);
+    }
+
+    // For threads that do not run a GrpcContext. Blocks of a resource are handed back to it through its remote-free
+    // list.
+    static void deallocate_unowned(void* p, std::size_t size, std::size_t alignment) noexcept
+    {
+        if (alignment > MAX_ALIGN)
+        {
+            deallocate_unowned(block_of(p), size + alignment, MAX_ALIGN);
+            return;
+        }
+        if (auto* const owner = Pool::owner_of(p))
+        {
+            owner->push_remote_block(p, detail::get_pool_index(size));
+        }
+        else
+        {
+            Pool::deallocate_unmanaged_block(p, detail::align(size, MAX_ALIGN));
+        }
     }
 
     void release() noexcept
     {
+        remote_free_list_.store(nullptr, std::memory_order_relaxed);
         for (auto& pool : pools_)
         {
             pool.release();
         }
     }
 
+    // Deallocates chunks that do not contain allocated blocks
+    void trim() noexcept
+    {
+        if (remote_free_list_.load(std::memory_order_relaxed) != nullptr)
+        {
+            drain_remote_free_list();
+        }
+        for (std::size_t i{}; i != POOL_COUNT; ++i)
+        {
+            pools_[i].trim(detail::get_block_size_of_pool_at(i));
+        }
+    }
+
+    // Thread-safe
+    [[nodiscard]] detail::PoolResourceStatistics statistics() const noexcept
+    {
+        detail::PoolResourceStatistics result{statistics_.local_deallocations_.load(std::memory_order_relaxed),
+                                              statistics_.remote_deallocations_.load(std::memory_order_relaxed),
+                                              statistics_.remote_frees_.load(std::memory_order_relaxed),
+                                              {}};
+        for (std::size_t i{}; i != POOL_COUNT; ++i)
+        {
+            const auto block_size = detail::get_block_size_of_pool_at(i);
+            result.pools[i] = {block_size, pools_[i].reserved_bytes(), pools_[i].used_blocks() * block_size};
+        }
+        return result;
+    }
+
   private:
-    static constexpr std::size_t POOL_COUNT = detail::get_pool_index(LARGEST_POOL_BLOCK_SIZE) + 1u;
+    struct RemoteFreeListEntry
+    {
+        RemoteFreeListEntry* next_;
+        std::size_t pool_index_;
+    };
+
+    struct Statistics
+    {
+        std::atomic_uint64_t local_deallocations_{};
+        std::atomic_uint64_t remote_deallocations_{};
+        std::atomic_uint64_t remote_frees_{};
+    };
+
+    static_assert(sizeof(RemoteFreeListEntry) <= SMALLEST_POOL_BLOCK_SIZE);
+
+    // The distance to the start of the block is stored right in front of the returned pointer. The distance is at least
+    // MAX_ALIGN because the block is max_align-aligned.
+    static void* align_block(void* block, std::size_t alignment) noexcept
+    {
+        const auto offset = alignment - reinterpret_cast<std::uintptr_t>(block) % alignment;
+        auto* const p = static_cast<char*>(block) + offset;
+        ::new (static_cast<void*>(p - sizeof(std::size_t))) std::size_t{offset};
+        return p;
+    }
+
+    static void* block_of(void* p) noexcept
+    {
+        auto* const aligned = static_cast<char*>(p);
+        return aligned - *std::launder(reinterpret_cast<std::size_t*>(aligned - sizeof(std::size_t)));
+    }
+
+    void push_remote_block(void* p, std::size_t pool_index) noexcept
+    {
+        auto* const entry = ::new (p) RemoteFreeListEntry{nullptr, pool_index};
+        auto* head = remote_free_list_.load(std::memory_order_relaxed);
+        do
+        {
+            entry->next_ = head;
+        } while (!remote_free_list_.compare_exchange_weak(head, entry, std::memory_order_release,
+                                                          std::memory_order_relaxed));
+    }
+
+    void drain_remote_free_list() noexcept
+    {
+        auto* entry = remote_free_list_.exchange(nullptr, std::memory_order_acquire);
+        std::uint64_t count{};
+        while (entry != nullptr)
+        {
+            auto* const next = entry->next_;
+            const auto pool_index = entry->pool_index_;
+            entry->~RemoteFreeListEntry();
+            pools_[pool_index].push_block(entry);
+            entry = next;
+            ++count;
+        }
+        detail::single_writer_add(statistics_.remote_frees_, count);
+    }
 
     Pool pools_[POOL_COUNT];
+    const std::atomic_size_t& largest_pooled_block_size_;
+    alignas(detail::CACHE_LINE_SIZE) std::atomic<RemoteFreeListEntry*> remote_free_list_{};
+    Statistics statistics_;
 };
 }
 
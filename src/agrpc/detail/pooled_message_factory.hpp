@@ -0,0 +1,68 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_POOLED_MESSAGE_FACTORY_HPP
+#define AGRPC_DETAIL_POOLED_MESSAGE_FACTORY_HPP
+
+#include <agrpc/detail/memory.hpp>
+#include <agrpc/detail/pool_resource_allocator.hpp>
+
+#include <cstddef>
+#include <new>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+struct PooledMessageNode
+{
+    PooledMessageNode* previous_;
+    PooledMessageNode* next_;
+    void (*destroy_)(detail::PooledMessageNode*) noexcept;
+};
+
+// The node is placed in front of the message so that it can be found from a reference to the message.
+template <class T>
+struct PooledMessageStorage
+{
+    static constexpr std::size_t MESSAGE_OFFSET = detail::align(sizeof(detail::PooledMessageNode), alignof(T));
+
+    static T& message(detail::PooledMessageNode& node) noexcept
+    {
+        return *std::launder(reinterpret_cast<T*>(reinterpret_cast<std::byte*>(&node) + MESSAGE_OFFSET));
+    }
+
+    static detail::PooledMessageNode& node(T& message) noexcept
+    {
+        return *std::launder(
+            reinterpret_cast<detail::PooledMessageNode*>(reinterpret_cast<std::byte*>(&message) - MESSAGE_OFFSET));
+    }
+
+    static void destroy(detail::PooledMessageNode* node) noexcept
+    {
+        message(*node).~T();
+        node->~PooledMessageNode();
+        detail::PoolResourceAllocator<PooledMessageStorage>{}.deallocate(
+            reinterpret_cast<PooledMessageStorage*>(node), 1);
+    }
+
+    alignas(T) alignas(detail::PooledMessageNode) std::byte data_[MESSAGE_OFFSET + sizeof(T)];
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_POOLED_MESSAGE_FACTORY_HPP
@@ -0,0 +1,67 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_QUEUE_DELAY_CONTROLLER_HPP
+#define AGRPC_DETAIL_QUEUE_DELAY_CONTROLLER_HPP
+
+#include <atomic>
+#include <chrono>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// CoDel as adapted for request queues: the smallest queue delay of an interval tells a standing queue apart from a
+// burst. If it exceeded the target then the next interval is overloaded and requests whose delay exceeds twice the
+// target are shed. Races between threads only blur the boundaries of an interval.
+class QueueDelayController
+{
+  public:
+    [[nodiscard]] bool should_shed(std::chrono::nanoseconds delay, std::chrono::steady_clock::time_point now,
+                                   std::chrono::nanoseconds target, std::chrono::nanoseconds interval) noexcept
+    {
+        const auto now_count = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        auto interval_end = interval_end_.load(std::memory_order_relaxed);
+        if (now_count >= interval_end)
+        {
+            if (interval_end_.compare_exchange_strong(interval_end, now_count + interval.count(),
+                                                      std::memory_order_relaxed))
+            {
+                const auto min_delay = min_delay_.exchange(delay.count(), std::memory_order_relaxed);
+                overloaded_.store(interval_end != 0 && min_delay > target.count(), std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            auto min_delay = min_delay_.load(std::memory_order_relaxed);
+            while (delay.count() < min_delay &&
+                   !min_delay_.compare_exchange_weak(min_delay, delay.count(), std::memory_order_relaxed))
+            {
+            }
+        }
+        return overloaded_.load(std::memory_order_relaxed) && delay > 2 * target;
+    }
+
+  private:
+    std::atomic<std::chrono::nanoseconds::rep> interval_end_{};
+    std::atomic<std::chrono::nanoseconds::rep> min_delay_{};
+    std::atomic_bool overloaded_{};
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_QUEUE_DELAY_CONTROLLER_HPP
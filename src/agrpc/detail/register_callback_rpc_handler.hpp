@@ -16,16 +16,51 @@
 #define AGRPC_DETAIL_REGISTER_CALLBACK_RPC_HANDLER_HPP
 
 #include <agrpc/detail/register_rpc_handler_asio_base.hpp>
+#include <agrpc/detail/server_rpc_allocation_cache.hpp>
 #include <agrpc/detail/server_rpc_with_request.hpp>
 #include <agrpc/grpc_context.hpp>
 #include <agrpc/server_rpc_ptr.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
 #include <agrpc/detail/config.hpp>
 
 AGRPC_NAMESPACE_BEGIN()
 
 namespace detail
 {
+template <class Message, class = void>
+inline constexpr bool MESSAGE_HAS_CLEAR = false;
+
+template <class Message>
+inline constexpr bool MESSAGE_HAS_CLEAR<Message, decltype((void)std::declval<Message&>().Clear())> = true;
+
+// Finished RPCs whose request message is created by the library keep their request message while in the allocation
+// cache, so that its internal buffers can be reused. Otherwise, only the memory is kept.
+template <class RequestMessageFactory, class Request>
+constexpr bool recycles_request_message() noexcept
+{
+    if constexpr (RequestMessageFactory::HAS_RESPONSE_FACTORY)
+    {
+        return false;
+    }
+    else if constexpr (RequestMessageFactory::HAS_INITIAL_REQUEST)
+    {
+        return !RequestMessageFactory::HAS_CUSTOM_FACTORY && detail::MESSAGE_HAS_CLEAR<Request>;
+    }
+    else
+    {
+        return true;
+    }
+}
+
+struct RecycledServerRPCAllocation
+{
+    RecycledServerRPCAllocation* next_;
+};
+
 template <class ServerRPC, class RPCHandler, class CompletionHandler>
 struct RegisterCallbackRPCHandlerOperation
     : detail::RegisterRPCHandlerOperationAsioBase<ServerRPC, RPCHandler, CompletionHandler>
@@ -38,32 +73,79 @@ struct RegisterCallbackRPCHandlerOperation
     using ServerRPCWithRequest = detail::ServerRPCWithRequest<ServerRPC>;
     using ServerRPCPtr = agrpc::ServerRPCPtr<ServerRPC>;
     using Starter = detail::ServerRPCStarter<>;
+    using RequestMessageFactory = detail::ServerRPCPtrRequestMessageFactoryT<ServerRPC, RPCHandler>;
+    using OperationAllocator = detail::RPCOperationAllocatorT<RequestMessageFactory, Allocator>;
 
-    struct ServerRPCAllocation : detail::ServerRPCPtrRequestMessageFactoryT<ServerRPC, RPCHandler>
+    static constexpr std::size_t ALLOCATION_CACHE_SIZE = ServerRPC::Traits::ALLOCATION_CACHE_SIZE;
+    static constexpr bool RECYCLES_REQUEST_MESSAGE =
+        detail::recycles_request_message<RequestMessageFactory, typename ServerRPC::Request>();
+
+    struct ServerRPCAllocation : RequestMessageFactory
     {
         ServerRPCAllocation(const ServerRPCExecutor& executor, RegisterCallbackRPCHandlerOperation& self)
-            : detail::ServerRPCPtrRequestMessageFactoryT<ServerRPC, RPCHandler>(self.rpc_handler(), executor),
-              self_(self)
+            : RequestMessageFactory(self.rpc_handler(), executor), self_(self)
+        {
+        }
+
+        OperationAllocator get_operation_allocator() noexcept
+        {
+            return detail::get_rpc_operation_allocator(*this, self_.get_allocator());
+        }
+
+        RegisterCallbackRPCHandlerOperation& self_;
+        ServerRPCAllocation* next_{};
+        bool accepted_{};
+        bool admitted_{};
+    };
+
+    using AllocationTraits = detail::RebindAllocatorTraits<ServerRPCAllocation, Allocator>;
+    using CacheItem =
+        std::conditional_t<RECYCLES_REQUEST_MESSAGE, ServerRPCAllocation, detail::RecycledServerRPCAllocation>;
+    using AllocationCache = detail::ServerRPCAllocationCache<CacheItem, ALLOCATION_CACHE_SIZE>;
+
+    struct DeallocateFunction
+    {
+        void operator()() const noexcept
         {
+            const bool accepted = allocation_.accepted_;
+            const bool admitted = allocation_.admitted_;
+            self_.deallocate_rpc(allocation_);
+            if (accepted)
+            {
+                self_.on_rpc_finished(admitted);
+            }
         }
 
         RegisterCallbackRPCHandlerOperation& self_;
+        ServerRPCAllocation& allocation_;
     };
 
+    using DeallocationGuard = detail::ScopeGuard<DeallocateFunction>;
+
     struct StartCallback
     {
-        using allocator_type = Allocator;
+        using allocator_type = OperationAllocator;
 
         void operator()(bool ok)
         {
             if (ok)
             {
                 self_.notify_when_done_work_started();
+                auto& rpc = *static_cast<ServerRPCAllocation*>(ptr_.server_rpc_);
+                const grpc::Status* const rejection = self_.admit_rpc();
+                rpc.accepted_ = true;
+                rpc.admitted_ = rejection == nullptr;
                 AGRPC_TRY
                 {
                     self_.initiate_next();
-                    auto& rpc = *static_cast<ServerRPCAllocation*>(ptr_.server_rpc_);
-                    Starter::invoke(self_.rpc_handler(), static_cast<ServerRPCPtr&&>(ptr_), rpc);
+                    if AGRPC_LIKELY (rpc.admitted_)
+                    {
+                        Starter::invoke(self_.rpc_handler(), static_cast<ServerRPCPtr&&>(ptr_), rpc);
+                    }
+                    else
+                    {
+                        self_.reject(static_cast<ServerRPCPtr&&>(ptr_), *rejection);
+                    }
                 }
                 AGRPC_CATCH(...)
                 {
@@ -76,34 +158,48 @@ struct RegisterCallbackRPCHandlerOperation
             else
             {
                 [[maybe_unused]] RefCountGuard a{self_};
-                [[maybe_unused]] detail::AllocationGuard b{*static_cast<ServerRPCAllocation*>(ptr_.release()),
-                                                           self_.get_allocator()};
+                [[maybe_unused]] DeallocationGuard b{
+                    DeallocateFunction{self_, *static_cast<ServerRPCAllocation*>(ptr_.release())}};
             }
         }
 
-        Allocator get_allocator() const noexcept { return self_.get_allocator(); }
+        OperationAllocator get_allocator() const noexcept { return allocator_; }
 
         RegisterCallbackRPCHandlerOperation& self_;
         ServerRPCPtr ptr_;
+        OperationAllocator allocator_;
     };
 
     struct WaitForDoneCallback
     {
-        using allocator_type = Allocator;
+        using allocator_type = OperationAllocator;
 
         void operator()(const detail::ErrorCode&) const noexcept {}
 
-        Allocator get_allocator() const noexcept { return self_.get_allocator(); }
+        OperationAllocator get_allocator() const noexcept { return allocator_; }
 
         RegisterCallbackRPCHandlerOperation& self_;
         ServerRPCPtr ptr_;
+        OperationAllocator allocator_;
+    };
+
+    struct RejectCallback
+    {
+        using allocator_type = OperationAllocator;
+
+        void operator()(bool) const noexcept {}
+
+        OperationAllocator get_allocator() const noexcept { return allocator_; }
+
+        ServerRPCPtr ptr_;
+        OperationAllocator allocator_;
     };
 
     static void wait_for_done_deleter(ServerRPCWithRequest* ptr) noexcept
     {
         auto& allocation = *static_cast<ServerRPCAllocation*>(ptr);
         [[maybe_unused]] RefCountGuard a{allocation.self_};
-        [[maybe_unused]] detail::AllocationGuard b{allocation, allocation.self_.get_allocator()};
+        [[maybe_unused]] DeallocationGuard b{DeallocateFunction{allocation.self_, allocation}};
     }
 
     static void deleter(ServerRPCWithRequest* ptr) noexcept
@@ -111,7 +207,7 @@ struct RegisterCallbackRPCHandlerOperation
         auto& allocation = *static_cast<ServerRPCAllocation*>(ptr);
         auto& self = allocation.self_;
         RefCountGuard ref_count_guard{self};
-        detail::AllocationGuard alloc_guard{allocation, self.get_allocator()};
+        DeallocationGuard alloc_guard{DeallocateFunction{self, allocation}};
         auto& rpc = ptr->rpc_;
         if (!detail::ServerRPCContextBaseAccess::is_finished(rpc))
         {
@@ -121,7 +217,8 @@ struct RegisterCallbackRPCHandlerOperation
         {
             if (!rpc.is_done())
             {
-                rpc.wait_for_done(WaitForDoneCallback{self, ServerRPCPtr{ptr, &wait_for_done_deleter}});
+                rpc.wait_for_done(WaitForDoneCallback{self, ServerRPCPtr{ptr, &wait_for_done_deleter},
+                                                      allocation.get_operation_allocator()});
                 ref_count_guard.release();
                 alloc_guard.release();
             }
@@ -132,30 +229,163 @@ struct RegisterCallbackRPCHandlerOperation
     RegisterCallbackRPCHandlerOperation(const ServerRPCExecutor& executor, Service& service, RPCHandler&& rpc_handler,
                                         Ch&& completion_handler)
         : Base(executor, service, static_cast<RPCHandler&&>(rpc_handler), static_cast<Ch&&>(completion_handler),
-               &detail::register_rpc_handler_asio_do_complete<RegisterCallbackRPCHandlerOperation>)
+               &do_complete)
+    {
+    }
+
+    static void do_complete(detail::RegisterRPCHandlerOperationComplete& operation) noexcept
     {
+        static_cast<RegisterCallbackRPCHandlerOperation&>(operation).clear_allocation_cache();
+        detail::register_rpc_handler_asio_do_complete<RegisterCallbackRPCHandlerOperation>(operation);
     }
 
     void initiate()
     {
-        auto ptr = detail::allocate<ServerRPCAllocation>(this->get_allocator(), this->get_executor(), *this);
+        auto& allocation = allocate_rpc();
         this->increment_ref_count();
-        perform_request_and_repeat({ptr.extract(), &deleter});
+        perform_request_and_repeat({&allocation, &deleter});
     }
 
     void initiate_next()
     {
-        if AGRPC_LIKELY (!this->is_stopped())
+        if AGRPC_LIKELY (!this->is_stopped() && this->admit_next_request())
         {
             initiate();
         }
     }
 
+    void on_rpc_finished(bool admitted) noexcept
+    {
+        if (this->rpc_finished(admitted) && !this->is_stopped())
+        {
+            AGRPC_TRY { initiate(); }
+            AGRPC_CATCH(...) { this->set_error(std::current_exception()); }
+        }
+    }
+
+    void reject(ServerRPCPtr&& ptr, const grpc::Status& status)
+    {
+        auto& allocation = *static_cast<ServerRPCAllocation*>(ptr.server_rpc_);
+        Starter::reject(allocation.rpc_, status,
+                        RejectCallback{static_cast<ServerRPCPtr&&>(ptr), allocation.get_operation_allocator()});
+    }
+
     void perform_request_and_repeat(ServerRPCPtr&& ptr)
     {
         auto& rpc = *static_cast<ServerRPCAllocation*>(ptr.server_rpc_);
-        Starter::start(rpc.rpc_, this->service(), rpc, StartCallback{*this, static_cast<ServerRPCPtr&&>(ptr)});
+        Starter::start(rpc.rpc_, this->service(), rpc,
+                       StartCallback{*this, static_cast<ServerRPCPtr&&>(ptr), rpc.get_operation_allocator()});
     }
+
+    bool is_cache_local() const noexcept
+    {
+        auto& grpc_context = this->grpc_context();
+        return !detail::GrpcContextImplementation::is_multithreaded(grpc_context) &&
+               detail::GrpcContextImplementation::running_in_this_thread(grpc_context);
+    }
+
+    ServerRPCAllocation& allocate_rpc()
+    {
+        if constexpr (ALLOCATION_CACHE_SIZE > 0)
+        {
+            const bool is_local = is_cache_local();
+            if (auto* const item = allocation_cache_.pop(is_local))
+            {
+                detail::ScopeGuard guard{[&]
+                                         {
+                                             deallocate_cached_rpc(*item);
+                                         }};
+                auto& allocation = reuse_rpc(*item);
+                guard.release();
+                return allocation;
+            }
+        }
+        return *detail::allocate<ServerRPCAllocation>(this->get_allocator(), this->get_executor(), *this).extract();
+    }
+
+    ServerRPCAllocation& reuse_rpc(CacheItem& item)
+    {
+        if constexpr (RECYCLES_REQUEST_MESSAGE)
+        {
+            ::new (static_cast<void*>(std::addressof(item.rpc_)))
+                ServerRPC(detail::ServerRPCContextBaseAccess::construct<ServerRPC>(this->get_executor()));
+            item.accepted_ = false;
+            item.admitted_ = false;
+            return item;
+        }
+        else
+        {
+            auto* const allocation = reinterpret_cast<ServerRPCAllocation*>(&item);
+            typename AllocationTraits::allocator_type allocator{this->get_allocator()};
+            AllocationTraits::construct(allocator, allocation, this->get_executor(), *this);
+            return *allocation;
+        }
+    }
+
+    void deallocate_rpc(ServerRPCAllocation& allocation) noexcept
+    {
+        if constexpr (ALLOCATION_CACHE_SIZE > 0)
+        {
+            recycle_rpc(allocation);
+        }
+        else
+        {
+            detail::AllocationGuard guard{allocation, this->get_allocator()};
+        }
+    }
+
+    void recycle_rpc(ServerRPCAllocation& allocation) noexcept
+    {
+        const bool is_local = is_cache_local();
+        if constexpr (RECYCLES_REQUEST_MESSAGE)
+        {
+            std::destroy_at(std::addressof(allocation.rpc_));
+            if constexpr (RequestMessageFactory::HAS_INITIAL_REQUEST)
+            {
+                allocation.get_request().Clear();
+            }
+            if (!allocation_cache_.push(allocation, is_local))
+            {
+                deallocate_cached_rpc(allocation);
+            }
+        }
+        else
+        {
+            typename AllocationTraits::allocator_type allocator{this->get_allocator()};
+            AllocationTraits::destroy(allocator, std::addressof(allocation));
+            auto& item = *::new (static_cast<void*>(&allocation)) CacheItem{};
+            if (!allocation_cache_.push(item, is_local))
+            {
+                deallocate_cached_rpc(item);
+            }
+        }
+    }
+
+    void deallocate_cached_rpc(CacheItem& item) noexcept
+    {
+        auto* const allocation = reinterpret_cast<ServerRPCAllocation*>(&item);
+        if constexpr (RECYCLES_REQUEST_MESSAGE && RequestMessageFactory::HAS_INITIAL_REQUEST)
+        {
+            // The ServerRPC has already been destructed, the request message is the only remaining member with a
+            // non-trivial destructor.
+            std::destroy_at(std::addressof(allocation->get_request()));
+        }
+        typename AllocationTraits::allocator_type allocator{this->get_allocator()};
+        AllocationTraits::deallocate(allocator,
+                                     std::pointer_traits<typename AllocationTraits::pointer>::pointer_to(*allocation),
+                                     1);
+    }
+
+    void clear_allocation_cache() noexcept
+    {
+        allocation_cache_.clear(
+            [&](CacheItem& item)
+            {
+                deallocate_cached_rpc(item);
+            });
+    }
+
+    AllocationCache allocation_cache_;
 };
 
 template <class ServerRPC>
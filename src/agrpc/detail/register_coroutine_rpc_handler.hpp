@@ -62,12 +62,21 @@ struct RegisterCoroutineRPCHandlerOperation
 
         void initiate_next()
         {
-            if AGRPC_LIKELY (!this->is_stopped())
+            if AGRPC_LIKELY (!this->is_stopped() && this->admit_next_request())
             {
                 initiate();
             }
         }
 
+        void on_rpc_finished(bool admitted) noexcept
+        {
+            if (this->rpc_finished(admitted) && !this->is_stopped())
+            {
+                AGRPC_TRY { initiate(); }
+                AGRPC_CATCH(...) { this->set_error(std::current_exception()); }
+            }
+        }
+
         template <class... Args>
         static Awaitable perform_request_and_repeat(RefCountGuard g, Args... args)
         {
@@ -75,15 +84,24 @@ struct RegisterCoroutineRPCHandlerOperation
             auto& self = static_cast<Type&>(g.get().self_);
             auto rpc = detail::ServerRPCContextBaseAccess::construct<ServerRPC>(self.get_executor());
             detail::ServerRPCRequestMessageFactoryT<ServerRPC, RPCHandler> factory{self.rpc_handler()};
-            if (!co_await Starter::start(rpc, self.service(), factory, self.completion_token()))
+            if (!co_await Starter::start(rpc, self.service(), factory, self.completion_token(factory)))
             {
                 co_return;
             }
             self.notify_when_done_work_started();
+            const grpc::Status* const rejection = self.admit_rpc();
+            const bool admitted = rejection == nullptr;
             AGRPC_TRY
             {
                 self.initiate_next();
-                co_await Starter::invoke(self.rpc_handler(), static_cast<Args&&>(args)..., rpc, factory);
+                if AGRPC_LIKELY (admitted)
+                {
+                    co_await Starter::invoke(self.rpc_handler(), static_cast<Args&&>(args)..., rpc, factory);
+                }
+                else
+                {
+                    co_await Starter::reject(rpc, *rejection, self.completion_token(factory));
+                }
             }
             AGRPC_CATCH(...) { self.set_error(std::current_exception()); }
             if (!detail::ServerRPCContextBaseAccess::is_finished(rpc))
@@ -94,21 +112,23 @@ struct RegisterCoroutineRPCHandlerOperation
             {
                 if (!rpc.is_done())
                 {
-                    co_await rpc.wait_for_done(self.completion_token());
+                    co_await rpc.wait_for_done(self.completion_token(factory));
                 }
             }
+            self.on_rpc_finished(admitted);
         }
 
-        auto completion_token()
+        template <class RequestMessageFactory>
+        auto completion_token(RequestMessageFactory& factory)
         {
-            if constexpr (detail::IS_STD_ALLOCATOR<Allocator>)
+            if constexpr (detail::IS_STD_ALLOCATOR<detail::RPCOperationAllocatorT<RequestMessageFactory, Allocator>>)
             {
                 return CoroTraits::completion_token(this->rpc_handler(), this->completion_handler());
             }
             else
             {
                 return detail::AllocatorBinder(
-                    this->get_allocator(),
+                    detail::get_rpc_operation_allocator(factory, this->get_allocator()),
                     CoroTraits::completion_token(this->rpc_handler(), this->completion_handler()));
             }
         }
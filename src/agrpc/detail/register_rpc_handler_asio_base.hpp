@@ -98,13 +98,36 @@ struct RegisterRPCHandlerInitiator
     void operator()(CompletionHandler&& completion_handler, const typename ServerRPC::executor_type& executor,
                     RPCHandler&& rpc_handler) const
     {
+        using Op = Operation<ServerRPC, detail::RemoveCrefT<RPCHandler>, detail::RemoveCrefT<CompletionHandler>>;
         const auto allocator = assoc::get_associated_allocator(completion_handler);
-        auto op = detail::allocate<
-            Operation<ServerRPC, detail::RemoveCrefT<RPCHandler>, detail::RemoveCrefT<CompletionHandler>>>(
-            allocator, executor, service_, static_cast<RPCHandler&&>(rpc_handler),
-            static_cast<CompletionHandler&&>(completion_handler));
+        auto op = detail::allocate<Op>(allocator, executor, service_, static_cast<RPCHandler&&>(rpc_handler),
+                                       static_cast<CompletionHandler&&>(completion_handler));
         (*op).initiate();
-        op.release();
+        if constexpr (Op::ACCEPT_BACKLOG > 1)
+        {
+            auto& self = *op;
+            self.increment_ref_count();
+            op.release();
+            initiate_backlog(self);
+        }
+        else
+        {
+            op.release();
+        }
+    }
+
+    template <class Op>
+    static void initiate_backlog(Op& self) noexcept
+    {
+        typename Op::RefCountGuard guard{self};
+        AGRPC_TRY
+        {
+            for (std::size_t i = 1; i != Op::ACCEPT_BACKLOG && !self.is_stopped(); ++i)
+            {
+                self.initiate();
+            }
+        }
+        AGRPC_CATCH(...) { self.set_error(std::current_exception()); }
     }
 
     detail::ServerRPCServiceT<ServerRPC>& service_;
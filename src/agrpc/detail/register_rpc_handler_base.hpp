@@ -17,11 +17,17 @@
 
 #include <agrpc/detail/atomic_bool_stop_context.hpp>
 #include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/grpc_context_implementation.hpp>
+#include <agrpc/detail/queue_delay_controller.hpp>
 #include <agrpc/detail/server_rpc_context_base.hpp>
+#include <agrpc/detail/server_rpc_starter.hpp>
 #include <agrpc/detail/utility.hpp>
+#include <agrpc/default_server_rpc_traits.hpp>
 #include <agrpc/grpc_context.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 
 #include <agrpc/detail/config.hpp>
 
@@ -62,6 +68,25 @@ struct RegisterRPCHandlerOperationBase : RegisterRPCHandlerOperationComplete, Re
     using Service = detail::ServerRPCServiceT<ServerRPC>;
     using ServerRPCExecutor = typename ServerRPC::executor_type;
 
+    static constexpr std::size_t ACCEPT_BACKLOG = ServerRPC::Traits::ACCEPT_BACKLOG;
+
+    static constexpr std::size_t MAX_IN_FLIGHT_RPCS = ServerRPC::Traits::MAX_IN_FLIGHT_RPCS;
+    static constexpr bool PAUSES_ACCEPTING =
+        MAX_IN_FLIGHT_RPCS > 0 &&
+        ServerRPC::Traits::IN_FLIGHT_LIMIT_POLICY == agrpc::InFlightLimitPolicy::PAUSE_ACCEPTING;
+    static constexpr bool REJECTS =
+        MAX_IN_FLIGHT_RPCS > 0 && ServerRPC::Traits::IN_FLIGHT_LIMIT_POLICY == agrpc::InFlightLimitPolicy::REJECT;
+
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_TARGET = ServerRPC::Traits::QUEUE_DELAY_TARGET;
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_INTERVAL = ServerRPC::Traits::QUEUE_DELAY_INTERVAL;
+    static constexpr bool SHEDS_LOAD = QUEUE_DELAY_TARGET.count() > 0;
+
+    static_assert(ACCEPT_BACKLOG > 0, "ServerRPC::Traits::ACCEPT_BACKLOG must be greater than zero");
+    static_assert(MAX_IN_FLIGHT_RPCS == 0 || MAX_IN_FLIGHT_RPCS >= ACCEPT_BACKLOG,
+                  "ServerRPC::Traits::MAX_IN_FLIGHT_RPCS must not be smaller than ACCEPT_BACKLOG");
+    static_assert(!SHEDS_LOAD || QUEUE_DELAY_INTERVAL.count() > 0,
+                  "ServerRPC::Traits::QUEUE_DELAY_INTERVAL must be greater than zero");
+
     RegisterRPCHandlerOperationBase(const ServerRPCExecutor& executor, Service& service, RPCHandler&& rpc_handler,
                                     RegisterRPCHandlerOperationComplete::Complete complete_fn,
                                     typename RegisterRPCHandlerOperationGetEnv<Env>::GetEnv get_env_fn = nullptr)
@@ -71,6 +96,18 @@ struct RegisterRPCHandlerOperationBase : RegisterRPCHandlerOperationComplete, Re
           service_(service),
           rpc_handler_(static_cast<RPCHandler&&>(rpc_handler))
     {
+        if constexpr (SHEDS_LOAD)
+        {
+            detail::GrpcContextImplementation::start_tracking_queue_delay(grpc_context());
+        }
+    }
+
+    ~RegisterRPCHandlerOperationBase() noexcept
+    {
+        if constexpr (SHEDS_LOAD)
+        {
+            detail::GrpcContextImplementation::stop_tracking_queue_delay(grpc_context());
+        }
     }
 
     bool is_stopped() const noexcept
@@ -100,6 +137,67 @@ struct RegisterRPCHandlerOperationBase : RegisterRPCHandlerOperationComplete, Re
 
     [[nodiscard]] bool decrement_ref_count() noexcept { return 0 == --reference_count_; }
 
+    // Called after a request has been accepted and before the next one is started. Returns false if the next request
+    // must wait until an rpc finishes.
+    [[nodiscard]] bool admit_next_request() noexcept
+    {
+        if constexpr (PAUSES_ACCEPTING)
+        {
+            return in_flight_.fetch_add(1, std::memory_order_relaxed) < MAX_IN_FLIGHT_RPCS;
+        }
+        else
+        {
+            return true;
+        }
+    }
+
+    // Called after a request has been accepted. Returns the status to reject the rpc with or nullptr if it is admitted.
+    [[nodiscard]] const grpc::Status* admit_rpc() noexcept
+    {
+        if constexpr (SHEDS_LOAD)
+        {
+            auto& grpc_context = this->grpc_context();
+            const auto now = std::chrono::steady_clock::now();
+            const auto delay = detail::GrpcContextImplementation::queue_delay(grpc_context, now);
+            const bool shed = queue_delay_controller_.should_shed(delay, now, QUEUE_DELAY_TARGET, QUEUE_DELAY_INTERVAL);
+            detail::GrpcContextImplementation::record_queue_delay(grpc_context, delay, shed);
+            if (shed)
+            {
+                return &detail::queue_delay_exceeded_status();
+            }
+        }
+        if constexpr (REJECTS)
+        {
+            if (in_flight_.fetch_add(1, std::memory_order_relaxed) >= MAX_IN_FLIGHT_RPCS)
+            {
+                in_flight_.fetch_sub(1, std::memory_order_relaxed);
+                return &detail::in_flight_limit_exceeded_status();
+            }
+        }
+        return nullptr;
+    }
+
+    // Called when an accepted rpc is destroyed, whether it has been admitted or rejected. Returns true if a request
+    // that has been held back must be started now.
+    [[nodiscard]] bool rpc_finished([[maybe_unused]] bool admitted) noexcept
+    {
+        if constexpr (PAUSES_ACCEPTING)
+        {
+            return in_flight_.fetch_sub(1, std::memory_order_relaxed) > MAX_IN_FLIGHT_RPCS;
+        }
+        else
+        {
+            if constexpr (REJECTS)
+            {
+                if (admitted)
+                {
+                    in_flight_.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+            return false;
+        }
+    }
+
     void notify_when_done_work_started() noexcept
     {
         if constexpr (ServerRPC::Traits::NOTIFY_WHEN_DONE)
@@ -111,6 +209,10 @@ struct RegisterRPCHandlerOperationBase : RegisterRPCHandlerOperationComplete, Re
     ServerRPCExecutor executor_;
     Service& service_;
     std::atomic_size_t reference_count_{};
+    // With PAUSE_ACCEPTING: outstanding requests + in-flight rpcs + held back requests, the latter being the amount by
+    // which the count exceeds MAX_IN_FLIGHT_RPCS. With REJECT: in-flight rpcs.
+    std::atomic_size_t in_flight_{PAUSES_ACCEPTING ? ACCEPT_BACKLOG : 0};
+    detail::QueueDelayController queue_delay_controller_;
     std::exception_ptr eptr_{};
     std::atomic_bool has_error_{};
     detail::AtomicBoolStopContext<exec::stop_token_of_t<Env>> stop_context_;
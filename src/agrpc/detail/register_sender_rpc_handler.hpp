@@ -96,11 +96,32 @@ template <class Receiver, class Signature, bool IsNotifyWhenDone>
 using GetWaitForDoneOperationStateT =
     typename GetWaitForDoneOperationState<Receiver, Signature, IsNotifyWhenDone>::Type;
 
+template <class ServerRPC, class RPCHandler, class Env>
+std::optional<std::exception_ptr> create_and_start_rpc_handler_operation(
+    RegisterRPCHandlerOperationBase<ServerRPC, RPCHandler, Env>& operation, const exec::allocator_of_t<Env>& allocator);
+
+template <class ServerRPC, class RPCHandler, class Env>
+void on_rpc_finished(RegisterRPCHandlerOperationBase<ServerRPC, RPCHandler, Env>& operation, bool admitted) noexcept
+{
+    if (operation.rpc_finished(admitted))
+    {
+        if (auto ep = detail::create_and_start_rpc_handler_operation(operation,
+                                                                     exec::get_allocator(operation.get_env())))
+        {
+            operation.set_error(static_cast<std::exception_ptr&&>(*ep));
+        }
+    }
+}
+
 template <class T>
 auto create_rpc_handler_operation_guard(T& t)
 {
-    return detail::Tuple{detail::ScopeGuard{[&base = t.base()]
+    return detail::Tuple{detail::ScopeGuard{[&base = t.base(), accepted = t.accepted_, admitted = t.admitted_]
                                             {
+                                                if (accepted)
+                                                {
+                                                    detail::on_rpc_finished(base, admitted);
+                                                }
                                                 if (base.decrement_ref_count())
                                                 {
                                                     base.complete();
@@ -151,10 +172,6 @@ struct RPCHandlerOperationWaitForDone
     }
 };
 
-template <class ServerRPC, class RPCHandler, class Env>
-std::optional<std::exception_ptr> create_and_start_rpc_handler_operation(
-    RegisterRPCHandlerOperationBase<ServerRPC, RPCHandler, Env>& operation, const exec::allocator_of_t<Env>& allocator);
-
 template <class ServerRPC, class RPCHandler, class Env>
 struct RPCHandlerOperation
 {
@@ -180,19 +197,34 @@ struct RPCHandlerOperation
             {
                 auto& base = op.base();
                 base.notify_when_done_work_started();
-                if (auto exception_ptr = op.emplace_rpc_handler_operation_state())
+                const grpc::Status* const rejection = base.admit_rpc();
+                const bool admitted = rejection == nullptr;
+                if (auto exception_ptr = admitted ? op.emplace_rpc_handler_operation_state()
+                                                  : op.emplace_reject_operation_state(*rejection))
                 {
                     op.rpc_.cancel();
                     base.set_error(static_cast<std::exception_ptr&&>(*exception_ptr));
                     return;
                 }
-                if (auto exception_ptr = detail::create_and_start_rpc_handler_operation(base, op.get_allocator()))
+                op.accepted_ = true;
+                op.admitted_ = admitted;
+                if (!base.is_stopped() && base.admit_next_request())
                 {
-                    op.rpc_.cancel();
-                    base.set_error(static_cast<std::exception_ptr&&>(*exception_ptr));
-                    return;
+                    if (auto exception_ptr = detail::create_and_start_rpc_handler_operation(base, op.get_allocator()))
+                    {
+                        op.rpc_.cancel();
+                        base.set_error(static_cast<std::exception_ptr&&>(*exception_ptr));
+                        return;
+                    }
+                }
+                if AGRPC_LIKELY (admitted)
+                {
+                    op.start_rpc_handler_operation_state();
+                }
+                else
+                {
+                    op.start_reject_operation_state();
                 }
-                op.start_rpc_handler_operation_state();
                 detail::release_rpc_handler_operation_guard(guard);
             }
         }
@@ -255,11 +287,16 @@ struct RPCHandlerOperation
     using FinishOperationState =
         detail::InplaceWithFunctionWrapper<exec::connect_result_t<RPCHandlerInvokeResult, FinishReceiver>>;
 
+    using RejectOperationState = detail::InplaceWithFunctionWrapper<exec::connect_result_t<
+        decltype(Starter::reject(std::declval<ServerRPC&>(), std::declval<const grpc::Status&>(), agrpc::use_sender)),
+        FinishReceiver>>;
+
     using WaitForDoneReceiver = Receiver<RPCHandlerOperationWaitForDone>;
     using WaitForDoneOperationState =
         detail::GetWaitForDoneOperationStateT<WaitForDoneReceiver, void(), ServerRPC::Traits::NOTIFY_WHEN_DONE>;
 
-    using OperationState = std::variant<StartOperationState, FinishOperationState, WaitForDoneOperationState>;
+    using OperationState =
+        std::variant<StartOperationState, FinishOperationState, RejectOperationState, WaitForDoneOperationState>;
 
     explicit RPCHandlerOperation(RegisterRPCHandlerOperationBase& operation)
         : impl1_(operation, operation.rpc_handler()),
@@ -304,6 +341,26 @@ struct RPCHandlerOperation
         exec::start(std::get<FinishOperationState>(operation_state_).value_);
     }
 
+    std::optional<std::exception_ptr> emplace_reject_operation_state(const grpc::Status& status) noexcept
+    {
+        AGRPC_TRY
+        {
+            operation_state_.template emplace<RejectOperationState>(
+                detail::InplaceWithFunction{},
+                [&]
+                {
+                    return exec::connect(Starter::reject(rpc_, status, agrpc::use_sender), FinishReceiver{*this});
+                });
+            return {};
+        }
+        AGRPC_CATCH(...) { return std::current_exception(); }
+    }
+
+    void start_reject_operation_state() noexcept
+    {
+        exec::start(std::get<RejectOperationState>(operation_state_).value_);
+    }
+
     void start_wait_for_done() noexcept
     {
         auto& state = operation_state_.template emplace<WaitForDoneOperationState>(
@@ -326,6 +383,8 @@ struct RPCHandlerOperation
     detail::CompressedPair<RegisterRPCHandlerOperationBase&, RequestMessageFactory> impl1_;
     ServerRPC rpc_;
     OperationState operation_state_;
+    bool accepted_{};
+    bool admitted_{};
 };
 
 template <class ServerRPC, class RPCHandler, class Env>
@@ -380,6 +439,11 @@ class RPCHandlerSenderOperation
         if (auto ep = detail::create_and_start_rpc_handler_operation(*this, get_allocator()))
         {
             exec::set_error(static_cast<Receiver&&>(receiver_), static_cast<std::exception_ptr&&>(*ep));
+            return;
+        }
+        if constexpr (Base::ACCEPT_BACKLOG > 1)
+        {
+            start_backlog();
         }
     }
 
@@ -394,6 +458,22 @@ class RPCHandlerSenderOperation
     {
     }
 
+    void start_backlog() noexcept
+    {
+        this->increment_ref_count();
+        for (std::size_t i = 1; i != Base::ACCEPT_BACKLOG && !this->is_stopped(); ++i)
+        {
+            if (auto ep = detail::create_and_start_rpc_handler_operation(*this, get_allocator()))
+            {
+                this->set_error(static_cast<std::exception_ptr&&>(*ep));
+            }
+        }
+        if (this->decrement_ref_count())
+        {
+            this->complete();
+        }
+    }
+
     static void complete_impl(RegisterRPCHandlerOperationComplete& operation) noexcept
     {
         auto& self = static_cast<RPCHandlerSenderOperation&>(operation);
@@ -21,6 +21,9 @@
 #include <agrpc/detail/register_rpc_handler_asio_base.hpp>
 #include <agrpc/detail/rethrow_first_arg.hpp>
 #include <agrpc/grpc_context.hpp>
+#include <agrpc/stack_pool.hpp>
+
+#include <memory>
 
 #ifdef AGRPC_STANDALONE_ASIO
 #include <asio/spawn.hpp>
@@ -35,16 +38,41 @@ AGRPC_NAMESPACE_BEGIN()
 
 namespace detail
 {
+#ifdef AGRPC_ASIO_HAS_NEW_SPAWN
+using SpawnStackOptions = agrpc::StackPool::StackAllocator;
+
+inline SpawnStackOptions get_spawn_stack_options(agrpc::StackPool& pool) noexcept { return pool.get_allocator(); }
+
 template <class Executor, class Function>
-void spawn(Executor&& executor, Function&& function)
+void spawn(Executor&& executor, const SpawnStackOptions& stack_allocator, Function&& function)
 {
-#ifdef AGRPC_ASIO_HAS_NEW_SPAWN
-    asio::spawn(static_cast<Executor&&>(executor), static_cast<Function&&>(function), detail::RethrowFirstArg{});
+    asio::spawn(static_cast<Executor&&>(executor), std::allocator_arg, SpawnStackOptions{stack_allocator},
+                static_cast<Function&&>(function), detail::RethrowFirstArg{});
+}
 #else
-    asio::spawn(static_cast<Executor&&>(executor), static_cast<Function&&>(function));
-#endif
+// The old asio::spawn does not support stack allocators, only the stack size can be customized.
+using SpawnStackOptions = std::size_t;
+
+inline SpawnStackOptions get_spawn_stack_options(agrpc::StackPool& pool) noexcept
+{
+    return pool.options().stack_size;
 }
 
+template <class Executor, class Function>
+void spawn(Executor&& executor, SpawnStackOptions stack_size, Function&& function)
+{
+    if (stack_size == 0)
+    {
+        asio::spawn(static_cast<Executor&&>(executor), static_cast<Function&&>(function));
+    }
+    else
+    {
+        asio::spawn(static_cast<Executor&&>(executor), static_cast<Function&&>(function),
+                    boost::coroutines::attributes(stack_size));
+    }
+}
+#endif
+
 template <class ServerRPC, class RPCHandler, class CompletionHandler>
 struct RegisterYieldRPCHandlerOperation
     : detail::RegisterRPCHandlerOperationAsioBase<ServerRPC, RPCHandler, CompletionHandler>
@@ -60,14 +88,15 @@ struct RegisterYieldRPCHandlerOperation
     RegisterYieldRPCHandlerOperation(const ServerRPCExecutor& executor, Service& service, RPCHandler&& rpc_handler,
                                      Ch&& completion_handler)
         : Base(executor, service, static_cast<RPCHandler&&>(rpc_handler), static_cast<Ch&&>(completion_handler),
-               &detail::register_rpc_handler_asio_do_complete<RegisterYieldRPCHandlerOperation>)
+               &detail::register_rpc_handler_asio_do_complete<RegisterYieldRPCHandlerOperation>),
+          stack_options_(detail::get_spawn_stack_options(asio::use_service<agrpc::StackPool>(this->grpc_context())))
     {
     }
 
     void initiate()
     {
         this->increment_ref_count();
-        detail::spawn(assoc::get_associated_executor(this->completion_handler(), this->get_executor()),
+        detail::spawn(assoc::get_associated_executor(this->completion_handler(), this->get_executor()), stack_options_,
                       [g = RefCountGuard{*this}](const auto& yield)
                       {
                           auto& self = static_cast<RegisterYieldRPCHandlerOperation&>(g.get().self_);
@@ -78,26 +107,44 @@ struct RegisterYieldRPCHandlerOperation
 
     void initiate_next()
     {
-        if AGRPC_LIKELY (!this->is_stopped())
+        if AGRPC_LIKELY (!this->is_stopped() && this->admit_next_request())
         {
             initiate();
         }
     }
 
+    void on_rpc_finished(bool admitted) noexcept
+    {
+        if (this->rpc_finished(admitted) && !this->is_stopped())
+        {
+            AGRPC_TRY { initiate(); }
+            AGRPC_CATCH(...) { this->set_error(std::current_exception()); }
+        }
+    }
+
     template <class Yield>
     void perform_request_and_repeat(const Yield& yield)
     {
         auto rpc = detail::ServerRPCContextBaseAccess::construct<ServerRPC>(this->get_executor());
         detail::ServerRPCRequestMessageFactoryT<ServerRPC, RPCHandler> factory{this->rpc_handler()};
-        if (!Starter::start(rpc, this->service(), factory, use_yield(yield)))
+        if (!Starter::start(rpc, this->service(), factory, use_yield(yield, factory)))
         {
             return;
         }
         this->notify_when_done_work_started();
+        const grpc::Status* const rejection = this->admit_rpc();
+        const bool admitted = rejection == nullptr;
         AGRPC_TRY
         {
             initiate_next();
-            Starter::invoke(this->rpc_handler(), rpc, factory, yield);
+            if AGRPC_LIKELY (admitted)
+            {
+                Starter::invoke(this->rpc_handler(), rpc, factory, yield);
+            }
+            else
+            {
+                Starter::reject(rpc, *rejection, use_yield(yield, factory));
+            }
         }
         AGRPC_CATCH(const std::exception&) { this->set_error(std::current_exception()); }
         if (!detail::ServerRPCContextBaseAccess::is_finished(rpc))
@@ -108,23 +155,26 @@ struct RegisterYieldRPCHandlerOperation
         {
             if (!rpc.is_done())
             {
-                rpc.wait_for_done(use_yield(yield));
+                rpc.wait_for_done(use_yield(yield, factory));
             }
         }
+        on_rpc_finished(admitted);
     }
 
-    template <class Yield>
-    decltype(auto) use_yield(const Yield& yield)
+    template <class Yield, class RequestMessageFactory>
+    decltype(auto) use_yield(const Yield& yield, RequestMessageFactory& factory)
     {
-        if constexpr (detail::IS_STD_ALLOCATOR<Allocator>)
+        if constexpr (detail::IS_STD_ALLOCATOR<detail::RPCOperationAllocatorT<RequestMessageFactory, Allocator>>)
         {
             return (yield);
         }
         else
         {
-            return detail::AllocatorBinder(this->get_allocator(), yield);
+            return detail::AllocatorBinder(detail::get_rpc_operation_allocator(factory, this->get_allocator()), yield);
         }
     }
+
+    detail::SpawnStackOptions stack_options_;
 };
 
 template <class ServerRPC>
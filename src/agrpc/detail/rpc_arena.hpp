@@ -0,0 +1,142 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_RPC_ARENA_HPP
+#define AGRPC_DETAIL_RPC_ARENA_HPP
+
+#include <agrpc/detail/math.hpp>
+#include <agrpc/detail/memory.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+inline constexpr std::size_t RPC_ARENA_MIN_CHUNK_SIZE = 1024;
+
+// Hands out memory from an externally owned initial buffer and, once that is exhausted, from chunks of geometrically
+// increasing size. Memory is only reclaimed when the resource is destructed, at which point the objects created
+// through `create` are destructed in reverse order of creation.
+class RPCArenaResource
+{
+  public:
+    RPCArenaResource(std::byte* buffer, std::size_t size) noexcept
+        : current_(buffer), remaining_(size), next_chunk_size_(detail::maximum(RPC_ARENA_MIN_CHUNK_SIZE, 2 * size))
+    {
+    }
+
+    RPCArenaResource(const RPCArenaResource&) = delete;
+    RPCArenaResource(RPCArenaResource&&) = delete;
+    RPCArenaResource& operator=(const RPCArenaResource&) = delete;
+    RPCArenaResource& operator=(RPCArenaResource&&) = delete;
+
+    ~RPCArenaResource() noexcept
+    {
+        for (auto* cleanup = cleanups_; cleanup != nullptr; cleanup = cleanup->next_)
+        {
+            cleanup->destroy_(cleanup->object_);
+        }
+        while (chunks_ != nullptr)
+        {
+            auto* chunk = chunks_;
+            chunks_ = chunk->next_;
+            detail::deallocate_already_max_aligned(chunk, chunk->size_);
+        }
+    }
+
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment)
+    {
+        void* p = current_;
+        if AGRPC_UNLIKELY (!std::align(alignment, size, p, remaining_))
+        {
+            p = allocate_chunk(size + alignment);
+            p = std::align(alignment, size, p, remaining_);
+        }
+        current_ = static_cast<std::byte*>(p) + size;
+        remaining_ -= size;
+        space_used_ += size;
+        return p;
+    }
+
+    template <class T, class... Args>
+    T& create(Args&&... args)
+    {
+        void* p = allocate(sizeof(T), alignof(T));
+        if constexpr (std::is_trivially_destructible_v<T>)
+        {
+            return *::new (p) T(static_cast<Args&&>(args)...);
+        }
+        else
+        {
+            void* cleanup = allocate(sizeof(Cleanup), alignof(Cleanup));
+            auto* object = ::new (p) T(static_cast<Args&&>(args)...);
+            cleanups_ = ::new (cleanup) Cleanup{&destroy_object<T>, object, cleanups_};
+            return *object;
+        }
+    }
+
+    [[nodiscard]] std::size_t space_used() const noexcept { return space_used_; }
+
+  private:
+    struct Chunk
+    {
+        Chunk* next_;
+        std::size_t size_;
+    };
+
+    struct Cleanup
+    {
+        void (*destroy_)(void*) noexcept;
+        void* object_;
+        Cleanup* next_;
+    };
+
+    static constexpr std::size_t CHUNK_HEADER_SIZE = detail::align(sizeof(Chunk), detail::MAX_ALIGN);
+
+    template <class T>
+    static void destroy_object(void* object) noexcept
+    {
+        static_cast<T*>(object)->~T();
+    }
+
+    void* allocate_chunk(std::size_t minimum_size)
+    {
+        const auto size =
+            detail::align(CHUNK_HEADER_SIZE + detail::maximum(next_chunk_size_, minimum_size), detail::MAX_ALIGN);
+        auto* chunk = ::new (detail::allocate_already_max_aligned(size)) Chunk{chunks_, size};
+        chunks_ = chunk;
+        next_chunk_size_ = 2 * size;
+        current_ = reinterpret_cast<std::byte*>(chunk) + CHUNK_HEADER_SIZE;
+        remaining_ = size - CHUNK_HEADER_SIZE;
+        return current_;
+    }
+
+    std::byte* current_;
+    std::size_t remaining_;
+    std::size_t next_chunk_size_;
+    std::size_t space_used_{};
+    Chunk* chunks_{};
+    Cleanup* cleanups_{};
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_RPC_ARENA_HPP
@@ -21,6 +21,7 @@
 #include <agrpc/detail/forward.hpp>
 #include <agrpc/detail/operation_implementation.hpp>
 #include <agrpc/detail/operation_initiation.hpp>
+#include <agrpc/detail/operation_slot.hpp>
 #include <agrpc/detail/stop_callback_lifetime.hpp>
 #include <agrpc/detail/utility.hpp>
 #include <agrpc/detail/work_tracking_completion_handler.hpp>
@@ -51,7 +52,12 @@ struct SenderImplementationOperation : public ImplementationT::BaseType,
         }
         else
         {
-            [[maybe_unused]] detail::AllocationGuard ptr{self, self.template get_allocator<AllocType>()};
+            detail::AllocationGuard ptr{self, self.template get_allocator<AllocType>()};
+            // The completion handler may own the storage of the operation, e.g. the OperationSlot of an rpc that lives
+            // in a coroutine frame. Destroy it last.
+            [[maybe_unused]] auto handler{static_cast<CompletionHandler&&>(self.completion_handler())};
+            [[maybe_unused]] auto tracker{static_cast<WorkTracker&&>(self.work_tracker())};
+            ptr.reset();
         }
     }
 
@@ -61,6 +67,10 @@ struct SenderImplementationOperation : public ImplementationT::BaseType,
         {
             return &do_complete<detail::AllocationType::LOCAL>;
         }
+        if (allocation_type == detail::AllocationType::SLOT)
+        {
+            return &do_complete<detail::AllocationType::SLOT>;
+        }
         return &do_complete<detail::AllocationType::CUSTOM>;
     }
 
@@ -84,6 +94,10 @@ struct SenderImplementationOperation : public ImplementationT::BaseType,
         {
             return detail::get_local_allocator();
         }
+        else if constexpr (AllocType == detail::AllocationType::SLOT)
+        {
+            return detail::OperationSlotAllocator<SenderImplementationOperation>{};
+        }
         else
         {
             return assoc::get_associated_allocator(completion_handler());
@@ -146,6 +160,38 @@ void submit_sender_implementation_operation(agrpc::GrpcContext& grpc_context, Co
         grpc_context, static_cast<CompletionHandler&&>(completion_handler), grpc_context, initiation,
         static_cast<Implementation&&>(implementation));
 }
+
+// Constructs the operation in the slot if it fits and the slot is free
+template <class CompletionHandler, class Initiation, class Implementation>
+void submit_sender_implementation_operation(agrpc::GrpcContext& grpc_context, detail::OperationSlot& slot,
+                                            CompletionHandler&& completion_handler, const Initiation& initiation,
+                                            Implementation&& implementation)
+{
+    using Operation = detail::SenderImplementationOperation<detail::RemoveCrefT<Implementation>,
+                                                            detail::RemoveCrefT<CompletionHandler>>;
+    if constexpr (detail::OperationSlot::FITS<Operation>)
+    {
+        if AGRPC_UNLIKELY (detail::GrpcContextImplementation::is_shutdown(grpc_context))
+        {
+            return;
+        }
+        void* const storage = slot.try_acquire();
+        if AGRPC_LIKELY (storage)
+        {
+            detail::ScopeGuard guard{[&]
+                                     {
+                                         slot.release();
+                                     }};
+            ::new (storage)
+                Operation(detail::AllocationType::SLOT, static_cast<CompletionHandler&&>(completion_handler),
+                          grpc_context, initiation, static_cast<Implementation&&>(implementation));
+            guard.release();
+            return;
+        }
+    }
+    detail::submit_sender_implementation_operation(grpc_context, static_cast<CompletionHandler&&>(completion_handler),
+                                                   initiation, static_cast<Implementation&&>(implementation));
+}
 }
 
 AGRPC_NAMESPACE_END
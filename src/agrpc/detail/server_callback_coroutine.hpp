@@ -17,9 +17,11 @@
 
 #include <agrpc/detail/asio_forward.hpp>
 #include <agrpc/detail/association.hpp>
+#include <agrpc/detail/coroutine_frame_allocator.hpp>
 #include <agrpc/detail/reactor_ptr.hpp>
 #include <agrpc/detail/reactor_ptr_type.hpp>
 #include <agrpc/detail/ref_counted_reactor.hpp>
+#include <agrpc/grpc_context.hpp>
 #include <agrpc/server_callback.hpp>
 #include <boost/cobalt/op.hpp>
 #include <boost/cobalt/this_coro.hpp>
@@ -99,7 +101,7 @@ class ServerReactorPromiseType final : private detail::ServerReactorPromiseBase<
   public:
     using executor_type = typename Reactor::executor_type;
 
-    static void* operator new(std::size_t size) { return ::operator new(size); }
+    static void* operator new(std::size_t size) { return detail::allocate_coroutine_frame(size); }
 
     static void operator delete(void* ptr) noexcept
     {
@@ -188,7 +190,7 @@ class ServerReactorPromiseType final : private detail::ServerReactorPromiseBase<
         auto& self = *static_cast<ServerReactorPromiseType*>(ptr);
         ReactorAccess::destroy_executor(self.reactor());
         self.destruct_reactor();
-        ::operator delete(Handle::from_promise(self).address());
+        detail::deallocate_coroutine_frame(Handle::from_promise(self).address());
     }
 };
 }
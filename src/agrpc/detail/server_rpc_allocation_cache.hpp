@@ -0,0 +1,133 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_SERVER_RPC_ALLOCATION_CACHE_HPP
+#define AGRPC_DETAIL_SERVER_RPC_ALLOCATION_CACHE_HPP
+
+#include <agrpc/detail/atomic_intrusive_queue.hpp>
+#include <agrpc/detail/intrusive_queue.hpp>
+#include <agrpc/detail/intrusive_stack.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+// Bounded cache for the allocations of finished RPCs.
+//
+// The thread that runs a single-threaded GrpcContext uses a plain stack, so that the most recently used allocation is
+// reused first. All other threads share a lock-free list. Items are taken from the shared list by removing the entire
+// list and putting back the remainder, which avoids the ABA problem of popping a single item.
+template <class Item, std::size_t Capacity>
+class ServerRPCAllocationCache
+{
+  public:
+    ServerRPCAllocationCache() = default;
+
+    ServerRPCAllocationCache(const ServerRPCAllocationCache&) = delete;
+    ServerRPCAllocationCache(ServerRPCAllocationCache&&) = delete;
+    ServerRPCAllocationCache& operator=(const ServerRPCAllocationCache&) = delete;
+    ServerRPCAllocationCache& operator=(ServerRPCAllocationCache&&) = delete;
+
+    [[nodiscard]] Item* pop(bool is_local) noexcept
+    {
+        if (is_local)
+        {
+            if (local_.empty())
+            {
+                refill_local();
+            }
+            if (local_.empty())
+            {
+                return nullptr;
+            }
+            --local_size_;
+            return &local_.pop_front();
+        }
+        detail::IntrusiveQueue<Item> items;
+        shared_.dequeue_all(items);
+        if (items.empty())
+        {
+            return nullptr;
+        }
+        auto* const item = items.pop_front();
+        (void)shared_.prepend(static_cast<detail::IntrusiveQueue<Item>&&>(items));
+        shared_size_.fetch_sub(1, std::memory_order_relaxed);
+        return item;
+    }
+
+    // Returns false if the cache is full.
+    [[nodiscard]] bool push(Item& item, bool is_local) noexcept
+    {
+        if (is_local)
+        {
+            if (local_size_ + shared_size_.load(std::memory_order_relaxed) >= Capacity)
+            {
+                return false;
+            }
+            ++local_size_;
+            local_.push_front(item);
+            return true;
+        }
+        if (shared_size_.fetch_add(1, std::memory_order_relaxed) >= Capacity)
+        {
+            shared_size_.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        (void)shared_.enqueue(&item);
+        return true;
+    }
+
+    // Not thread-safe
+    template <class Function>
+    void clear(Function function) noexcept
+    {
+        refill_local();
+        while (!local_.empty())
+        {
+            function(local_.pop_front());
+        }
+        local_size_ = 0;
+        shared_size_.store(0, std::memory_order_relaxed);
+    }
+
+  private:
+    void refill_local() noexcept
+    {
+        detail::IntrusiveQueue<Item> items;
+        shared_.dequeue_all(items);
+        std::size_t count{};
+        while (!items.empty())
+        {
+            local_.push_front(*items.pop_front());
+            ++count;
+        }
+        local_size_ += count;
+        shared_size_.fetch_sub(count, std::memory_order_relaxed);
+    }
+
+    detail::IntrusiveStack<Item> local_;
+    std::size_t local_size_{};
+    detail::AtomicIntrusiveQueue<Item> shared_;
+    std::atomic_size_t shared_size_{};
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_SERVER_RPC_ALLOCATION_CACHE_HPP
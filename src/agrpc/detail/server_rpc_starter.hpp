@@ -33,6 +33,14 @@ inline constexpr bool REQUEST_MESSAGE_FACTORY_HAS_DESTROY<Request, RequestMessag
                                                           decltype((void)std::declval<RequestMessageFactory&>().destroy(
                                                               std::declval<Request&>()))> = true;
 
+template <class MessageFactory, class = void>
+inline constexpr bool MESSAGE_FACTORY_HAS_ALLOCATOR = false;
+
+template <class MessageFactory>
+inline constexpr bool
+    MESSAGE_FACTORY_HAS_ALLOCATOR<MessageFactory, decltype((void)std::declval<MessageFactory&>().get_allocator())> =
+        true;
+
 using DefaultRequestMessageFactory = void;
 
 template <class RPCHandler, class = void>
@@ -51,10 +59,29 @@ struct GetRPCHandlerRequestMessageFactory<RPCHandler,
 template <class RPCHandler>
 using RPCHandlerRequestMessageFactoryT = typename GetRPCHandlerRequestMessageFactory<RPCHandler>::Type;
 
+using DefaultResponseMessageFactory = void;
+
+template <class RPCHandler, class = void>
+struct GetRPCHandlerResponseMessageFactory
+{
+    using Type = DefaultResponseMessageFactory;
+};
+
+template <class RPCHandler>
+struct GetRPCHandlerResponseMessageFactory<RPCHandler,
+                                           decltype((void)std::declval<RPCHandler&>().response_message_factory())>
+{
+    using Type = decltype(std::declval<RPCHandler&>().response_message_factory());
+};
+
+template <class RPCHandler>
+using RPCHandlerResponseMessageFactoryT = typename GetRPCHandlerResponseMessageFactory<RPCHandler>::Type;
+
 template <template <class, bool> class BaseT, class RequestT, class Factory>
 struct RequestMessageFactoryBuilderMixin : BaseT<RequestT, true>
 {
     static constexpr bool HAS_CUSTOM_FACTORY = true;
+    static constexpr bool HAS_FACTORY_ALLOCATOR = MESSAGE_FACTORY_HAS_ALLOCATOR<Factory>;
 
     using Base = BaseT<RequestT, true>;
 
@@ -79,6 +106,8 @@ struct RequestMessageFactoryBuilderMixin : BaseT<RequestT, true>
 
     Factory& get_factory() noexcept { return request_factory_; }
 
+    auto get_factory_allocator() noexcept { return request_factory_.get_allocator(); }
+
     Factory request_factory_;
 };
 
@@ -86,6 +115,7 @@ template <template <class, bool> class BaseT, class RequestT>
 struct RequestMessageFactoryBuilderMixin<BaseT, RequestT, DefaultRequestMessageFactory> : BaseT<RequestT, false>
 {
     static constexpr bool HAS_CUSTOM_FACTORY = false;
+    static constexpr bool HAS_FACTORY_ALLOCATOR = false;
 
     using Base = BaseT<RequestT, false>;
 
@@ -119,6 +149,7 @@ template <template <class, bool> class BaseT, class RequestT, class Factory>
 struct RequestMessageFactoryMixin<BaseT, RequestT, Factory, false> : BaseT<RequestT, false>
 {
     static constexpr bool HAS_INITIAL_REQUEST = false;
+    static constexpr bool HAS_FACTORY_ALLOCATOR = false;
 
     using Base = BaseT<RequestT, false>;
 
@@ -134,16 +165,77 @@ struct PickServerRPCRequestMessage
     using Type = detail::ServerRPCRequestMessage<Request, NeedsRequestPtr>;
 };
 
+// The response message factory lives next to the request message factory for the entire duration of the RPC. It is
+// passed to the rpc handler as its last argument.
+template <class Base, class Factory>
+struct ResponseMessageFactoryMixin : Base
+{
+    static constexpr bool HAS_RESPONSE_FACTORY = true;
+    static constexpr bool HAS_FACTORY_ALLOCATOR =
+        Base::HAS_FACTORY_ALLOCATOR || MESSAGE_FACTORY_HAS_ALLOCATOR<Factory>;
+
+    template <class RPCHandler, class... Args>
+    explicit ResponseMessageFactoryMixin(RPCHandler& rpc_handler, Args&&... args)
+        : Base(rpc_handler, static_cast<Args&&>(args)...),
+          response_factory_(rpc_handler.response_message_factory())
+    {
+    }
+
+    Factory& get_response_factory() noexcept { return response_factory_; }
+
+    auto get_factory_allocator() noexcept
+    {
+        if constexpr (Base::HAS_FACTORY_ALLOCATOR)
+        {
+            return Base::get_factory_allocator();
+        }
+        else
+        {
+            return response_factory_.get_allocator();
+        }
+    }
+
+    Factory response_factory_;
+};
+
+template <class Base>
+struct ResponseMessageFactoryMixin<Base, DefaultResponseMessageFactory> : Base
+{
+    static constexpr bool HAS_RESPONSE_FACTORY = false;
+
+    using Base::Base;
+};
+
 template <template <class, bool> class Base, class ServerRPC, class RPCHandler>
-using RequestMessageFactoryServerRPCMixinT =
+using RequestMessageFactoryServerRPCMixinT = detail::ResponseMessageFactoryMixin<
     detail::RequestMessageFactoryMixin<Base, typename ServerRPC::Request,
                                        detail::RPCHandlerRequestMessageFactoryT<RPCHandler>,
-                                       detail::has_initial_request(ServerRPC::TYPE)>;
+                                       detail::has_initial_request(ServerRPC::TYPE)>,
+    detail::RPCHandlerResponseMessageFactoryT<RPCHandler>>;
 
 template <class ServerRPC, class RPCHandler>
 using ServerRPCRequestMessageFactoryT =
     detail::RequestMessageFactoryServerRPCMixinT<PickServerRPCRequestMessage::template Type, ServerRPC, RPCHandler>;
 
+// Operations that the library initiates on behalf of a single RPC obtain their memory from the request or response
+// message factory if it provides an allocator, e.g. agrpc::BasicRPCArena.
+template <class RequestMessageFactory, class Allocator>
+auto get_rpc_operation_allocator(RequestMessageFactory& factory, const Allocator& allocator) noexcept
+{
+    if constexpr (RequestMessageFactory::HAS_FACTORY_ALLOCATOR)
+    {
+        return factory.get_factory_allocator();
+    }
+    else
+    {
+        return allocator;
+    }
+}
+
+template <class RequestMessageFactory, class Allocator>
+using RPCOperationAllocatorT = decltype(detail::get_rpc_operation_allocator(std::declval<RequestMessageFactory&>(),
+                                                                            std::declval<const Allocator&>()));
+
 template <class... PrependedArgs>
 struct ServerRPCStarter
 {
@@ -178,25 +270,69 @@ struct ServerRPCStarter
         {
             if constexpr (RequestMessageFactory::HAS_CUSTOM_FACTORY)
             {
-                return static_cast<RPCHandler&&>(handler)(
-                    static_cast<PrependedArgs&&>(prepend)..., static_cast<RPC&&>(rpc), factory.get_request(),
-                    static_cast<AppendedArgs&&>(append)..., factory.get_factory());
+                return invoke_with_response_factory(
+                    static_cast<RPCHandler&&>(handler), factory, static_cast<PrependedArgs&&>(prepend)...,
+                    static_cast<RPC&&>(rpc), factory.get_request(), static_cast<AppendedArgs&&>(append)...,
+                    factory.get_factory());
             }
             else
             {
-                return static_cast<RPCHandler&&>(handler)(static_cast<PrependedArgs&&>(prepend)...,
-                                                          static_cast<RPC&&>(rpc), factory.get_request(),
-                                                          static_cast<AppendedArgs&&>(append)...);
+                return invoke_with_response_factory(static_cast<RPCHandler&&>(handler), factory,
+                                                    static_cast<PrependedArgs&&>(prepend)..., static_cast<RPC&&>(rpc),
+                                                    factory.get_request(), static_cast<AppendedArgs&&>(append)...);
             }
         }
         else
         {
-            return static_cast<RPCHandler&&>(handler)(static_cast<PrependedArgs&&>(prepend)..., static_cast<RPC&&>(rpc),
-                                                      static_cast<AppendedArgs&&>(append)...);
+            return invoke_with_response_factory(static_cast<RPCHandler&&>(handler), factory,
+                                                static_cast<PrependedArgs&&>(prepend)..., static_cast<RPC&&>(rpc),
+                                                static_cast<AppendedArgs&&>(append)...);
+        }
+    }
+
+    template <class RPCHandler, class RequestMessageFactory, class... Args>
+    static decltype(auto) invoke_with_response_factory(RPCHandler&& handler, RequestMessageFactory& factory,
+                                                       Args&&... args)
+    {
+        if constexpr (RequestMessageFactory::HAS_RESPONSE_FACTORY)
+        {
+            return static_cast<RPCHandler&&>(handler)(static_cast<Args&&>(args)..., factory.get_response_factory());
+        }
+        else
+        {
+            return static_cast<RPCHandler&&>(handler)(static_cast<Args&&>(args)...);
+        }
+    }
+
+    // Finishes an rpc without invoking the rpc handler. The status must outlive the operation.
+    template <auto RequestRPC, class TraitsT, class Executor, class CompletionToken>
+    static auto reject(agrpc::ServerRPC<RequestRPC, TraitsT, Executor>& rpc, const grpc::Status& status,
+                       CompletionToken&& token)
+    {
+        using RPC = agrpc::ServerRPC<RequestRPC, TraitsT, Executor>;
+        if constexpr (RPC::TYPE == agrpc::ServerRPCType::UNARY || RPC::TYPE == agrpc::ServerRPCType::CLIENT_STREAMING)
+        {
+            return rpc.finish_with_error(status, static_cast<CompletionToken&&>(token));
+        }
+        else
+        {
+            return rpc.finish(status, static_cast<CompletionToken&&>(token));
         }
     }
 };
 
+inline const grpc::Status& in_flight_limit_exceeded_status()
+{
+    static const grpc::Status status{grpc::StatusCode::RESOURCE_EXHAUSTED, "Too many in-flight rpcs"};
+    return status;
+}
+
+inline const grpc::Status& queue_delay_exceeded_status()
+{
+    static const grpc::Status status{grpc::StatusCode::RESOURCE_EXHAUSTED, "Queue delay exceeds target"};
+    return status;
+}
+
 template <class ServerRPC, class RPCHandler, class RequestMessageFactory, class... Args>
 using RPCHandlerInvokeResultT =
     decltype(ServerRPCStarter<Args...>::invoke(std::declval<RPCHandler>(), std::declval<ServerRPC>(),
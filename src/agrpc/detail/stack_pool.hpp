@@ -0,0 +1,133 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_STACK_POOL_HPP
+#define AGRPC_DETAIL_STACK_POOL_HPP
+
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+using StackContext = boost::context::stack_context;
+
+// Stacks of a single size that are kept for reuse after their coroutine ended. Thread-safe.
+class StackPool
+{
+  public:
+    StackPool(std::size_t stack_size, bool guard_page, std::size_t max_pooled_stacks)
+        : stack_size_(stack_size == 0 ? boost::context::stack_traits::default_size() : stack_size),
+          max_pooled_stacks_(max_pooled_stacks),
+          guard_page_(guard_page)
+    {
+        // Reserved upfront so that returning a stack to the pool never allocates
+        stacks_.reserve(max_pooled_stacks);
+    }
+
+    StackPool(const StackPool&) = delete;
+    StackPool(StackPool&&) = delete;
+    StackPool& operator=(const StackPool&) = delete;
+    StackPool& operator=(StackPool&&) = delete;
+
+    ~StackPool() noexcept
+    {
+        for (auto& stack : stacks_)
+        {
+            deallocate_stack(stack);
+        }
+    }
+
+    [[nodiscard]] StackContext allocate()
+    {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard lock{mutex_};
+            if (!stacks_.empty())
+            {
+                const auto stack = stacks_.back();
+                stacks_.pop_back();
+                reuses_.fetch_add(1, std::memory_order_relaxed);
+                return stack;
+            }
+        }
+        if (guard_page_)
+        {
+            return boost::context::protected_fixedsize_stack{stack_size_}.allocate();
+        }
+        return boost::context::fixedsize_stack{stack_size_}.allocate();
+    }
+
+    void deallocate(StackContext& stack) noexcept
+    {
+        {
+            std::lock_guard lock{mutex_};
+            if (stacks_.size() < max_pooled_stacks_)
+            {
+                stacks_.push_back(stack);
+                return;
+            }
+        }
+        deallocate_stack(stack);
+    }
+
+    [[nodiscard]] std::size_t stack_size() const noexcept { return stack_size_; }
+
+    [[nodiscard]] std::uint64_t allocations() const noexcept { return allocations_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint64_t reuses() const noexcept { return reuses_.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] std::size_t pooled_stacks() const
+    {
+        std::lock_guard lock{mutex_};
+        return stacks_.size();
+    }
+
+  private:
+    void deallocate_stack(StackContext& stack) noexcept
+    {
+        if (guard_page_)
+        {
+            boost::context::protected_fixedsize_stack{stack_size_}.deallocate(stack);
+        }
+        else
+        {
+            boost::context::fixedsize_stack{stack_size_}.deallocate(stack);
+        }
+    }
+
+    const std::size_t stack_size_;
+    const std::size_t max_pooled_stacks_;
+    const bool guard_page_;
+    mutable std::mutex mutex_;
+    std::vector<StackContext> stacks_;
+    std::atomic<std::uint64_t> allocations_{};
+    std::atomic<std::uint64_t> reuses_{};
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_STACK_POOL_HPP
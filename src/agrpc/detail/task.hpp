@@ -0,0 +1,500 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_TASK_HPP
+#define AGRPC_DETAIL_TASK_HPP
+
+#include <agrpc/detail/awaitable.hpp>
+
+#ifdef AGRPC_ASIO_HAS_CO_AWAIT
+
+#include <agrpc/detail/allocate.hpp>
+#include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/association.hpp>
+#include <agrpc/detail/coroutine_frame_allocator.hpp>
+#include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/pool_resource_allocator.hpp>
+#include <agrpc/detail/utility.hpp>
+#include <agrpc/detail/work_tracking_completion_handler.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <stop_token>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+struct TaskGetStopTokenArg
+{
+};
+
+struct TaskGetExecutorArg
+{
+};
+
+template <class T>
+struct TaskReadyAwaiter
+{
+    static constexpr bool await_ready() noexcept { return true; }
+
+    static constexpr void await_suspend(std::coroutine_handle<>) noexcept {}
+
+    T await_resume() noexcept { return static_cast<T&&>(value_); }
+
+    T value_;
+};
+
+template <class Executor>
+class TaskPromiseBase
+{
+  public:
+    using executor_type = Executor;
+
+    static void* operator new(std::size_t size) { return detail::allocate_coroutine_frame(size); }
+
+    static void operator delete(void* ptr) noexcept { detail::deallocate_coroutine_frame(ptr); }
+
+    static std::suspend_always initial_suspend() noexcept { return {}; }
+
+    auto final_suspend() const noexcept { return FinalAwaiter{}; }
+
+    auto await_transform(detail::TaskGetStopTokenArg) const noexcept
+    {
+        return detail::TaskReadyAwaiter<std::stop_token>{stop_token_};
+    }
+
+    auto await_transform(detail::TaskGetExecutorArg) const noexcept
+    {
+        return detail::TaskReadyAwaiter<Executor>{*executor_};
+    }
+
+    template <class Awaitable>
+    Awaitable&& await_transform(Awaitable&& awaitable) const noexcept
+    {
+        return static_cast<Awaitable&&>(awaitable);
+    }
+
+    [[nodiscard]] const Executor& get_executor() const noexcept { return *executor_; }
+
+    [[nodiscard]] const std::stop_token& get_stop_token() const noexcept { return stop_token_; }
+
+    // Called before the coroutine is resumed for the first time
+    void start(const Executor& executor, std::stop_token stop_token, std::coroutine_handle<> continuation) noexcept
+    {
+        executor_.emplace(executor);
+        stop_token_ = static_cast<std::stop_token&&>(stop_token);
+        continuation_ = continuation;
+    }
+
+    // Called before the coroutine is resumed for the first time, for tasks that are not awaited by another task
+    void start(const Executor& executor, std::stop_token stop_token, void (*on_done)(void*), void* on_done_arg) noexcept
+    {
+        executor_.emplace(executor);
+        stop_token_ = static_cast<std::stop_token&&>(stop_token);
+        on_done_ = on_done;
+        on_done_arg_ = on_done_arg;
+    }
+
+  private:
+    struct FinalAwaiter
+    {
+        static constexpr bool await_ready() noexcept { return false; }
+
+        template <class Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        {
+            TaskPromiseBase& self = handle.promise();
+            if (self.on_done_)
+            {
+                // Destroys the coroutine frame
+                self.on_done_(self.on_done_arg_);
+                return std::noop_coroutine();
+            }
+            return self.continuation_;
+        }
+
+        static constexpr void await_resume() noexcept {}
+    };
+
+    std::optional<Executor> executor_;
+    std::stop_token stop_token_;
+    std::coroutine_handle<> continuation_;
+    void (*on_done_)(void*){};
+    void* on_done_arg_;
+};
+
+template <class T>
+class TaskPromiseResult
+{
+  public:
+    template <class U = T>
+    void return_value(U&& value)
+    {
+        value_.emplace(static_cast<U&&>(value));
+    }
+
+    void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+    [[nodiscard]] const std::exception_ptr& exception() const noexcept { return exception_; }
+
+    T result()
+    {
+        if AGRPC_UNLIKELY (exception_)
+        {
+            std::rethrow_exception(exception_);
+        }
+        return static_cast<T&&>(*value_);
+    }
+
+    T& value() noexcept { return *value_; }
+
+  private:
+    std::exception_ptr exception_;
+    std::optional<T> value_;
+};
+
+template <>
+class TaskPromiseResult<void>
+{
+  public:
+    static constexpr void return_void() noexcept {}
+
+    void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+    [[nodiscard]] const std::exception_ptr& exception() const noexcept { return exception_; }
+
+    void result() const
+    {
+        if AGRPC_UNLIKELY (exception_)
+        {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+  private:
+    std::exception_ptr exception_;
+};
+
+struct TaskAccess
+{
+    template <class T, class Executor>
+    static auto release(agrpc::Task<T, Executor>& task) noexcept
+    {
+        return std::exchange(task.handle_, nullptr);
+    }
+};
+
+template <class T, class Executor>
+class TaskPromise : public detail::TaskPromiseBase<Executor>, public detail::TaskPromiseResult<T>
+{
+  public:
+    agrpc::Task<T, Executor> get_return_object() noexcept
+    {
+        return agrpc::Task<T, Executor>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+    }
+};
+
+template <class T, class Executor>
+class TaskAwaiter
+{
+  private:
+    using Handle = std::coroutine_handle<detail::TaskPromise<T, Executor>>;
+
+  public:
+    explicit TaskAwaiter(Handle handle) noexcept : handle_(handle) {}
+
+    static constexpr bool await_ready() noexcept { return false; }
+
+    // Symmetric transfer into the awaited task, its final_suspend transfers back to the awaiting one
+    template <class Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> continuation) const noexcept
+    {
+        static_assert(std::is_base_of_v<detail::TaskPromiseBase<Executor>, Promise>,
+                      "agrpc::Task can only be awaited by an agrpc::Task with the same executor type");
+        const detail::TaskPromiseBase<Executor>& parent = continuation.promise();
+        handle_.promise().start(parent.get_executor(), parent.get_stop_token(), continuation);
+        return handle_;
+    }
+
+    T await_resume() const { return handle_.promise().result(); }
+
+  private:
+    Handle handle_;
+};
+
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+struct TaskStopFunction
+{
+    void operator()() const { signal_.emit(asio::cancellation_type::all); }
+
+    asio::cancellation_signal& signal_;
+};
+#endif
+
+template <class... Args>
+struct TaskOperationState
+{
+    std::optional<std::tuple<std::decay_t<Args>...>> result_;
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+    // Declared before the stop callback that refers to it
+    std::optional<asio::cancellation_signal> signal_;
+    std::optional<std::stop_callback<detail::TaskStopFunction>> stop_callback_;
+#endif
+};
+
+template <class Executor, class... Args>
+class TaskOperationHandler
+{
+  public:
+    using executor_type = Executor;
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+    using cancellation_slot_type = asio::cancellation_slot;
+#endif
+
+    TaskOperationHandler(detail::TaskOperationState<Args...>& state, std::coroutine_handle<> handle,
+                         const Executor& executor) noexcept
+        : state_(&state), handle_(handle), executor_(executor)
+    {
+    }
+
+    template <class... T>
+    void operator()(T&&... args)
+    {
+        state_->result_.emplace(static_cast<T&&>(args)...);
+        handle_.resume();
+    }
+
+    [[nodiscard]] executor_type get_executor() const noexcept { return executor_; }
+
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+    [[nodiscard]] cancellation_slot_type get_cancellation_slot() const noexcept
+    {
+        return state_->signal_ ? state_->signal_->slot() : cancellation_slot_type{};
+    }
+#endif
+
+  private:
+    detail::TaskOperationState<Args...>* state_;
+    std::coroutine_handle<> handle_;
+    Executor executor_;
+};
+
+// Awaitable that is returned by asynchronous operations that are initiated with `agrpc::use_task`. The operation is
+// initiated from within await_suspend using a completion handler that resumes the task directly, without any
+// intermediate allocation.
+template <class Initiation, class InitArgs, class... Args>
+class TaskOperation : private detail::TaskOperationState<Args...>
+{
+  public:
+    template <class Init, class... T>
+    explicit TaskOperation(Init&& initiation, T&&... init_args)
+        : initiation_(static_cast<Init&&>(initiation)), init_args_{static_cast<T&&>(init_args)...}
+    {
+    }
+
+    TaskOperation(const TaskOperation&) = delete;
+    TaskOperation(TaskOperation&&) = default;
+    TaskOperation& operator=(const TaskOperation&) = delete;
+    TaskOperation& operator=(TaskOperation&&) = delete;
+
+    static constexpr bool await_ready() noexcept { return false; }
+
+    // The completion handler may resume the task before the initiation returns. `this` must therefore not be
+    // accessed after initiating the operation.
+    template <class Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle)
+    {
+        using Executor = typename Promise::executor_type;
+        const detail::TaskPromiseBase<Executor>& promise = handle.promise();
+        detail::TaskOperationState<Args...>& state = *this;
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+        if (const auto& stop_token = promise.get_stop_token(); stop_token.stop_possible())
+        {
+            auto& signal = state.signal_.emplace();
+            state.stop_callback_.emplace(stop_token, detail::TaskStopFunction{signal});
+        }
+#endif
+        std::apply(
+            [&](auto&&... init_args)
+            {
+                static_cast<Initiation&&>(initiation_)(
+                    detail::TaskOperationHandler<Executor, Args...>{state, handle, promise.get_executor()},
+                    static_cast<decltype(init_args)&&>(init_args)...);
+            },
+            static_cast<InitArgs&&>(init_args_));
+    }
+
+    auto await_resume()
+    {
+        if constexpr (sizeof...(Args) == 1)
+        {
+            return std::get<0>(std::move(*this->result_));
+        }
+        else if constexpr (sizeof...(Args) > 1)
+        {
+            return std::move(*this->result_);
+        }
+    }
+
+  private:
+    Initiation initiation_;
+    InitArgs init_args_;
+};
+
+template <class T>
+struct TaskSpawnSignature
+{
+    using Type = void(std::exception_ptr, T);
+};
+
+template <>
+struct TaskSpawnSignature<void>
+{
+    using Type = void(std::exception_ptr);
+};
+
+template <class T>
+using TaskSpawnSignatureT = typename TaskSpawnSignature<T>::Type;
+
+template <class T, class Executor, class CompletionHandler>
+class TaskSpawnOperation
+{
+  private:
+    using Handle = std::coroutine_handle<detail::TaskPromise<T, Executor>>;
+    using HandlerExecutor = assoc::associated_executor_t<CompletionHandler, Executor>;
+    using HandlerAllocator = assoc::associated_allocator_t<CompletionHandler>;
+
+  public:
+    template <class Ch>
+    TaskSpawnOperation(Handle handle, const Executor& executor, Ch&& completion_handler)
+        : handle_(handle),
+          completion_handler_(static_cast<Ch&&>(completion_handler)),
+          work_tracker_(assoc::get_associated_executor(completion_handler_, executor))
+    {
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+        if (auto slot = asio::get_associated_cancellation_slot(completion_handler_); slot.is_connected())
+        {
+            stop_source_.emplace();
+            slot.template emplace<StopOnCancel>(*stop_source_);
+        }
+#endif
+    }
+
+    // Like other operations of this library, the operation state is allocated from the pool of the GrpcContext of
+    // the current thread unless the completion handler has an associated allocator.
+    static auto get_allocator(const CompletionHandler& completion_handler) noexcept
+    {
+        if constexpr (detail::IS_STD_ALLOCATOR<HandlerAllocator>)
+        {
+            return detail::PoolResourceAllocator<TaskSpawnOperation>{};
+        }
+        else
+        {
+            return assoc::get_associated_allocator(completion_handler);
+        }
+    }
+
+    [[nodiscard]] std::stop_token get_stop_token() const noexcept
+    {
+        return stop_source_ ? stop_source_->get_token() : std::stop_token{};
+    }
+
+    static void complete(void* arg) noexcept
+    {
+        auto& self = *static_cast<TaskSpawnOperation*>(arg);
+        const auto handle = self.handle_;
+        detail::AllocationGuard guard{self, get_allocator(self.completion_handler_)};
+        auto completion_handler{static_cast<CompletionHandler&&>(self.completion_handler_)};
+        [[maybe_unused]] auto tracker{static_cast<detail::WorkTracker<HandlerExecutor>&&>(self.work_tracker_)};
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+        if (self.stop_source_)
+        {
+            asio::get_associated_cancellation_slot(completion_handler).clear();
+        }
+#endif
+        auto& promise = handle.promise();
+        auto exception = promise.exception();
+        if constexpr (std::is_void_v<T>)
+        {
+            guard.reset();
+            handle.destroy();
+            detail::dispatch_with_args(static_cast<CompletionHandler&&>(completion_handler),
+                                       static_cast<std::exception_ptr&&>(exception));
+        }
+        else
+        {
+            auto value = exception ? T{} : static_cast<T&&>(promise.value());
+            guard.reset();
+            handle.destroy();
+            detail::dispatch_with_args(static_cast<CompletionHandler&&>(completion_handler),
+                                       static_cast<std::exception_ptr&&>(exception), static_cast<T&&>(value));
+        }
+    }
+
+  private:
+#ifdef AGRPC_ASIO_HAS_CANCELLATION_SLOT
+    struct StopOnCancel
+    {
+        void operator()(asio::cancellation_type) const { stop_source_.request_stop(); }
+
+        std::stop_source& stop_source_;
+    };
+#endif
+
+    Handle handle_;
+    CompletionHandler completion_handler_;
+    detail::WorkTracker<HandlerExecutor> work_tracker_;
+    std::optional<std::stop_source> stop_source_;
+};
+
+template <class Executor>
+struct TaskSpawnInitiation
+{
+    template <class CompletionHandler, class T>
+    void operator()(CompletionHandler&& completion_handler, agrpc::Task<T, Executor>&& task) const
+    {
+        using Operation = detail::TaskSpawnOperation<T, Executor, detail::RemoveCrefT<CompletionHandler>>;
+        const auto handle = detail::TaskAccess::release(task);
+        detail::ScopeGuard guard{[&]
+                                 {
+                                     handle.destroy();
+                                 }};
+        auto* const operation = detail::allocate<Operation>(Operation::get_allocator(completion_handler), handle,
+                                                            executor_, static_cast<CompletionHandler&&>(completion_handler))
+                                    .extract();
+        guard.release();
+        handle.promise().start(executor_, operation->get_stop_token(), &Operation::complete, operation);
+        asio::post(executor_,
+                   [handle]
+                   {
+                       handle.resume();
+                   });
+    }
+
+    Executor executor_;
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif
+
+#endif  // AGRPC_DETAIL_TASK_HPP
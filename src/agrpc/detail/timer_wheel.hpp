@@ -0,0 +1,279 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_DETAIL_TIMER_WHEEL_HPP
+#define AGRPC_DETAIL_TIMER_WHEEL_HPP
+
+#include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/intrusive_list.hpp>
+#include <agrpc/detail/intrusive_list_hook.hpp>
+#include <agrpc/detail/math.hpp>
+#include <agrpc/detail/operation_base.hpp>
+#include <grpcpp/alarm.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+namespace detail
+{
+struct AlarmTimerWheelHandle;
+
+struct TimerWheelEntry : detail::IntrusiveListHook<TimerWheelEntry>
+{
+    std::uint64_t expiry_;
+    void* tag_;
+    detail::AlarmTimerWheelHandle* handle_;
+    std::uint16_t slot_;
+    bool ok_;
+};
+
+// Hierarchical timer wheel, see "Hashed and Hierarchical Timing Wheels" by Varghese and Lauck. Adding and removing an
+// entry is O(1). Entries whose expiry is too far into the future to be placed into the highest level are repeatedly
+// cascaded through it until they fit. Not thread-safe.
+class TimerWheel
+{
+  public:
+    static constexpr std::uint64_t NO_TICK = std::numeric_limits<std::uint64_t>::max();
+
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] std::uint64_t current_tick() const noexcept { return current_tick_; }
+
+    // Only valid to call when empty
+    void reset(std::uint64_t current_tick) noexcept { current_tick_ = current_tick; }
+
+    void add(detail::TimerWheelEntry& entry, std::uint64_t expiry) noexcept
+    {
+        entry.expiry_ = expiry;
+        ++size_;
+        place(entry);
+    }
+
+    // Moves the entry into the list of expired entries, unless it already is in there
+    void expire(detail::TimerWheelEntry& entry, bool ok) noexcept
+    {
+        if (entry.slot_ == EXPIRED_SLOT)
+        {
+            return;
+        }
+        slots_[entry.slot_].remove(&entry);
+        push_expired(entry, ok);
+    }
+
+    [[nodiscard]] detail::TimerWheelEntry* pop_expired() noexcept
+    {
+        if (expired_.empty())
+        {
+            return nullptr;
+        }
+        auto& entry = *expired_.begin();
+        expired_.remove(&entry);
+        --size_;
+        return &entry;
+    }
+
+    // Moves all entries into the list of expired entries
+    void expire_all(bool ok) noexcept
+    {
+        for (auto& slot : slots_)
+        {
+            while (!slot.empty())
+            {
+                auto& entry = *slot.begin();
+                slot.remove(&entry);
+                push_expired(entry, ok);
+            }
+        }
+    }
+
+    // The tick at which advance() has something to do: expire entries or cascade them into a lower level
+    [[nodiscard]] std::uint64_t next_tick() const noexcept
+    {
+        return expired_.empty() ? next_slot_tick() : current_tick_;
+    }
+
+    // Moves all entries that expire at or before `now` into the list of expired entries
+    void advance(std::uint64_t now) noexcept
+    {
+        for (auto tick = next_slot_tick(); tick <= now; tick = next_slot_tick())
+        {
+            current_tick_ = tick;
+            for (std::size_t level = LEVELS; level-- != 0;)
+            {
+                if ((tick & ((std::uint64_t{1} << (level * SLOT_BITS)) - 1)) != 0)
+                {
+                    continue;
+                }
+                auto& slot = slots_[slot_index(level, tick)];
+                while (!slot.empty())
+                {
+                    auto& entry = *slot.begin();
+                    slot.remove(&entry);
+                    place(entry);
+                }
+            }
+        }
+        if (now > current_tick_)
+        {
+            current_tick_ = now;
+        }
+    }
+
+  private:
+    static constexpr std::size_t SLOT_BITS = 6;
+    static constexpr std::size_t SLOTS_PER_LEVEL = std::size_t{1} << SLOT_BITS;
+    static constexpr std::size_t LEVELS = 4;
+    static constexpr std::uint64_t MAX_DELTA = (std::uint64_t{1} << (LEVELS * SLOT_BITS)) - 1;
+    static constexpr std::uint16_t EXPIRED_SLOT = std::numeric_limits<std::uint16_t>::max();
+
+    static std::uint16_t slot_index(std::size_t level, std::uint64_t tick) noexcept
+    {
+        return static_cast<std::uint16_t>(level * SLOTS_PER_LEVEL +
+                                          ((tick >> (level * SLOT_BITS)) & (SLOTS_PER_LEVEL - 1)));
+    }
+
+    void push_expired(detail::TimerWheelEntry& entry, bool ok) noexcept
+    {
+        entry.ok_ = ok;
+        entry.slot_ = EXPIRED_SLOT;
+        expired_.push_back(&entry);
+    }
+
+    void place(detail::TimerWheelEntry& entry) noexcept
+    {
+        if (entry.expiry_ <= current_tick_)
+        {
+            push_expired(entry, true);
+            return;
+        }
+        const auto delta = entry.expiry_ - current_tick_;
+        const auto placement_delta = delta < MAX_DELTA ? delta : MAX_DELTA;
+        const auto level = detail::floor_log2(static_cast<std::size_t>(placement_delta)) / SLOT_BITS;
+        entry.slot_ = slot_index(level, current_tick_ + placement_delta);
+        slots_[entry.slot_].push_back(&entry);
+    }
+
+    // An entry in level L is always placed into a slot whose level-L granule lies within the next SLOTS_PER_LEVEL
+    // granules. The first non-empty slot following the current granule is therefore the next one that is due.
+    [[nodiscard]] std::uint64_t next_slot_tick() const noexcept
+    {
+        auto result = NO_TICK;
+        for (std::size_t level{}; level != LEVELS; ++level)
+        {
+            const auto shift = level * SLOT_BITS;
+            const auto granule = current_tick_ >> shift;
+            for (std::uint64_t i{1}; i <= SLOTS_PER_LEVEL; ++i)
+            {
+                if (!slots_[slot_index(level, (granule + i) << shift)].empty())
+                {
+                    const auto tick = (granule + i) << shift;
+                    result = tick < result ? tick : result;
+                    break;
+                }
+            }
+        }
+        return result;
+    }
+
+    std::uint64_t current_tick_{};
+    std::size_t size_{};
+    detail::IntrusiveList<detail::TimerWheelEntry> expired_;
+    detail::IntrusiveList<detail::TimerWheelEntry> slots_[LEVELS * SLOTS_PER_LEVEL];
+};
+
+struct TimerWheelOperation : detail::OperationBase
+{
+    TimerWheelOperation() noexcept : detail::OperationBase(&do_complete) {}
+
+    static void do_complete(detail::OperationBase*, detail::OperationResult result, agrpc::GrpcContext& grpc_context);
+};
+
+// The timer wheel of a GrpcContext that backs agrpc::Alarm. A single grpc::Alarm is set for the next tick at which the
+// wheel has something to do.
+struct AlarmTimerWheel
+{
+    AlarmTimerWheel() = default;
+
+    AlarmTimerWheel(const AlarmTimerWheel&) = delete;
+    AlarmTimerWheel(AlarmTimerWheel&&) = delete;
+    AlarmTimerWheel& operator=(const AlarmTimerWheel&) = delete;
+    AlarmTimerWheel& operator=(AlarmTimerWheel&&) = delete;
+
+    ~AlarmTimerWheel() noexcept
+    {
+        while (!free_entries_.empty())
+        {
+            auto& entry = *free_entries_.begin();
+            free_entries_.remove(&entry);
+            delete &entry;
+        }
+    }
+
+    detail::TimerWheelEntry& allocate_entry()
+    {
+        if (free_entries_.empty())
+        {
+            return *(new detail::TimerWheelEntry{});
+        }
+        auto& entry = *free_entries_.begin();
+        free_entries_.remove(&entry);
+        return entry;
+    }
+
+    void deallocate_entry(detail::TimerWheelEntry& entry) noexcept { free_entries_.push_back(&entry); }
+
+    std::mutex mutex_;
+    detail::TimerWheel wheel_;
+    std::chrono::nanoseconds::rep resolution_{};
+    std::uint64_t armed_tick_{};
+    bool is_armed_{};
+    bool is_cancelling_{};
+    detail::IntrusiveList<detail::TimerWheelEntry> free_entries_;
+    grpc::Alarm alarm_;
+    detail::TimerWheelOperation operation_;
+};
+
+// Refers to the entry of an outstanding agrpc::Alarm wait in the timer wheel. The GrpcContext clears it when the wait
+// completes, afterwards the handle no longer accesses the GrpcContext. Destroying or assigning to the handle cancels
+// the outstanding wait.
+struct AlarmTimerWheelHandle
+{
+    AlarmTimerWheelHandle() = default;
+
+    AlarmTimerWheelHandle(const AlarmTimerWheelHandle&) = delete;
+
+    AlarmTimerWheelHandle(AlarmTimerWheelHandle&& other) noexcept;
+
+    ~AlarmTimerWheelHandle() noexcept;
+
+    AlarmTimerWheelHandle& operator=(const AlarmTimerWheelHandle&) = delete;
+
+    AlarmTimerWheelHandle& operator=(AlarmTimerWheelHandle&& other) noexcept;
+
+    agrpc::GrpcContext* grpc_context_{};
+    std::atomic<detail::TimerWheelEntry*> entry_{};
+};
+}
+
+AGRPC_NAMESPACE_END
+
+#endif  // AGRPC_DETAIL_TIMER_WHEEL_HPP
@@ -23,15 +23,20 @@
 #include <agrpc/detail/grpc_executor_options.hpp>
 #include <agrpc/detail/intrusive_list.hpp>
 #include <agrpc/detail/intrusive_queue.hpp>
-#include <agrpc/detail/intrusive_stack.hpp>
 #include <agrpc/detail/listable_pool_resource.hpp>
+#include <agrpc/detail/memory.hpp>
 #include <agrpc/detail/operation_base.hpp>
+#include <agrpc/detail/timer_wheel.hpp>
 #include <grpcpp/alarm.h>
 #include <grpcpp/completion_queue.h>
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <agrpc/detail/config.hpp>
 
@@ -62,6 +67,138 @@ class GrpcContext
      */
     using allocator_type = detail::GrpcContextLocalAllocator;
 
+    /**
+     * @brief (experimental) Statistics of the busy-poll mode
+     *
+     * @see set_busy_poll_duration()
+     *
+     * @since 3.8.0
+     */
+    struct BusyPollStatistics
+    {
+        /**
+         * @brief Total time spent polling the `grpc::CompletionQueue` without blocking
+         */
+        std::chrono::nanoseconds spin_duration;
+
+        /**
+         * @brief Total time spent blocked on the `grpc::CompletionQueue` after the spin budget was exhausted
+         */
+        std::chrono::nanoseconds sleep_duration;
+
+        /**
+         * @brief Number of completion queue events obtained while spinning
+         */
+        std::uint64_t spin_events;
+
+        /**
+         * @brief Number of completion queue events obtained after blocking
+         */
+        std::uint64_t sleep_events;
+    };
+
+    /**
+     * @brief (experimental) Statistics of the queue delay of rpcs
+     *
+     * @see DefaultServerRPCTraits::QUEUE_DELAY_TARGET
+     *
+     * @since 3.8.0
+     */
+    struct QueueDelayStatistics
+    {
+        /**
+         * @brief Sum of the queue delays of all rpcs
+         */
+        std::chrono::nanoseconds total_delay;
+
+        /**
+         * @brief Largest queue delay of an rpc
+         */
+        std::chrono::nanoseconds max_delay;
+
+        /**
+         * @brief Number of rpcs whose queue delay has been measured
+         */
+        std::uint64_t rpcs;
+
+        /**
+         * @brief Number of rpcs that have been rejected because of their queue delay
+         */
+        std::uint64_t rejected_rpcs;
+    };
+
+    /**
+     * @brief (experimental) Statistics of one size class of a memory resource behind get_allocator()
+     *
+     * @see MemoryResourceStatistics
+     *
+     * @since 3.8.0
+     */
+    struct MemorySizeClassStatistics
+    {
+        /**
+         * @brief Size of the blocks handed out for allocations of this size class
+         */
+        std::size_t block_size;
+
+        /**
+         * @brief Number of bytes obtained from the global heap for this size class, including bookkeeping
+         */
+        std::size_t reserved_bytes;
+
+        /**
+         * @brief Number of bytes in blocks that are currently allocated
+         *
+         * Includes blocks that were deallocated through another resource but have not been reclaimed yet.
+         */
+        std::size_t used_bytes;
+    };
+
+    /**
+     * @brief (experimental) Statistics of one memory resource behind get_allocator()
+     *
+     * Every thread that runs the GrpcContext allocates from its own memory resource. Memory that is deallocated by a
+     * different thread than the one that allocated it is handed back to the allocating thread's resource. A large
+     * difference between `remote_deallocations` of one resource and `remote_frees` of another indicates that
+     * operations tend to be started on one thread and completed on another.
+     *
+     * @see memory_resource_statistics()
+     *
+     * @since 3.8.0
+     */
+    struct MemoryResourceStatistics
+    {
+        /**
+         * @brief Number of blocks that were allocated and deallocated through this resource
+         */
+        std::uint64_t local_deallocations;
+
+        /**
+         * @brief Number of blocks that were deallocated through this resource but handed back to another one
+         */
+        std::uint64_t remote_deallocations;
+
+        /**
+         * @brief Number of blocks of this resource that were deallocated through another one and have been reclaimed
+         */
+        std::uint64_t remote_frees;
+
+        /**
+         * @brief Sum of `reserved_bytes` of all size classes
+         */
+        std::size_t reserved_bytes;
+
+        /**
+         * @brief Sum of `used_bytes` of all size classes
+         */
+        std::size_t used_bytes;
+
+        /**
+         * @brief Statistics per size class, ordered by block size
+         */
+        std::vector<MemorySizeClassStatistics> size_classes;
+    };
+
     /**
      * @brief Construct a GrpcContext for gRPC clients
      *
@@ -73,7 +210,8 @@ class GrpcContext
      * @brief Construct a GrpcContext for multi-threaded gRPC clients
      *
      * @arg concurrency_hint If greater than one then this GrpcContext's run*()/poll*() functions may be called from
-     * multiple threads
+     * multiple threads. Locally queued completion handlers are handed to other threads only while fewer than
+     * `concurrency_hint` threads are busy.
      *
      * @since 3.2.0
      */
@@ -104,7 +242,8 @@ class GrpcContext
      * @snippet server.cpp create-multi-threaded-grpc_context-server-side
      *
      * @arg concurrency_hint If greater than one then this GrpcContext's run*()/poll*() functions may be called from
-     * multiple threads
+     * multiple threads. Locally queued completion handlers are handed to other threads only while fewer than
+     * `concurrency_hint` threads are busy.
      *
      * @since 3.2.0
      */
@@ -267,8 +406,12 @@ class GrpcContext
     /**
      * @brief Get the associated allocator
      *
-     * @attention The returned allocator may only be used for allocations/deallocations within the same thread(s) that
-     * calls run*()/poll*() and not within nested calls from other GrpcContexts.
+     * Allocations are served by the memory resource of the GrpcContext that runs on the current thread. Threads that do
+     * not run a GrpcContext obtain memory from the global heap and hand pooled memory back to its resource through a
+     * lock-free list. (since 3.8.0)
+     *
+     * @attention Memory that was allocated by a thread running a GrpcContext must be deallocated before that
+     * GrpcContext is destructed.
      *
      * Thread-safe
      */
@@ -292,6 +435,188 @@ class GrpcContext
      */
     void work_finished() noexcept;
 
+    /**
+     * @brief (experimental) Poll the `grpc::CompletionQueue` for the specified duration before blocking on it
+     *
+     * Trades CPU time for latency: Instead of going to sleep immediately when there is no more work, the run*()
+     * functions keep polling the `grpc::CompletionQueue` until an event arrives or `duration` has elapsed. Only then do
+     * they block. This avoids the cost of waking up a sleeping thread, which is significant for latency-sensitive
+     * request patterns like unary ping-pong. A duration of zero, the default, disables busy-polling.
+     *
+     * While busy-polling is enabled, the time spent spinning and sleeping is recorded, see busy_poll_statistics().
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void set_busy_poll_duration(std::chrono::nanoseconds duration) noexcept;
+
+    /**
+     * @brief (experimental) Get the duration set by set_busy_poll_duration()
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::chrono::nanoseconds busy_poll_duration() const noexcept;
+
+    /**
+     * @brief (experimental) Set the maximum number of completion queue events to handle in a row
+     *
+     * By default, the run*() and poll*() functions handle one event of the `grpc::CompletionQueue` and then go back to
+     * processing locally queued completion handlers and checking for work submitted from other threads. Under high load
+     * that results in many small loop iterations. With a batch size greater than one, up to that many events that are
+     * already available are handled before switching to local work. Larger values reduce the per-event overhead at the
+     * cost of delaying local work. A value of zero is treated like one.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void set_completion_queue_batch_size(std::size_t batch_size) noexcept;
+
+    /**
+     * @brief (experimental) Get the batch size set by set_completion_queue_batch_size()
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::size_t completion_queue_batch_size() const noexcept;
+
+    /**
+     * @brief (experimental) Set the maximum number of locally queued completion handlers to run in a row
+     *
+     * Completion handlers that are submitted from within the GrpcContext, for example by `asio::post`, are collected
+     * into a local queue. By default, each iteration of the run*() and poll*() functions runs the entire local queue
+     * before it handles the next event of the `grpc::CompletionQueue`. When many such completion handlers are queued,
+     * incoming gRPC events can be delayed significantly. With a non-zero budget, at most that many completion handlers
+     * are run before the next `grpc::CompletionQueue` event is handled, so the two interleave fairly. A value of zero,
+     * the default, disables the budget.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void set_local_work_budget(std::size_t budget) noexcept;
+
+    /**
+     * @brief (experimental) Get the budget set by set_local_work_budget()
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::size_t local_work_budget() const noexcept;
+
+    /**
+     * @brief (experimental) Set the resolution of the timer wheel that backs agrpc::Alarm
+     *
+     * By default, every wait of an agrpc::Alarm sets its own `grpc::Alarm`. With a non-zero resolution, waits that are
+     * started afterwards are instead managed by a hierarchical timer wheel of this GrpcContext. Starting and cancelling
+     * a wait then takes constant time and only a single `grpc::Alarm` is set, for the earliest expiry. Waits that
+     * expire within the same tick of the given resolution complete together, at most one tick after their deadline.
+     * This is useful when many alarms are outstanding at the same time, like per-request timeouts. A value of zero, the
+     * default, disables the timer wheel.
+     *
+     * The resolution takes effect once all waits that are managed by the timer wheel have completed. The timer wheel is
+     * allocated by the first call with a non-zero resolution.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void set_alarm_resolution(std::chrono::nanoseconds resolution);
+
+    /**
+     * @brief (experimental) Get the resolution set by set_alarm_resolution()
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::chrono::nanoseconds alarm_resolution() const noexcept;
+
+    /**
+     * @brief (experimental) Get the statistics of the busy-poll mode
+     *
+     * Statistics are only recorded while busy-polling is enabled.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] BusyPollStatistics busy_poll_statistics() const noexcept;
+
+    /**
+     * @brief (experimental) Get the statistics of the queue delay of rpcs
+     *
+     * Statistics are only recorded for rpcs of `register_*_rpc_handler` whose traits set a `QUEUE_DELAY_TARGET`.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] QueueDelayStatistics queue_delay_statistics() const noexcept;
+
+    /**
+     * @brief (experimental) Get the statistics of all memory resources behind get_allocator()
+     *
+     * Returns one entry per memory resource. The GrpcContext starts with `concurrency_hint` resources and creates
+     * another one whenever more threads than that run it at the same time.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::vector<MemoryResourceStatistics> memory_resource_statistics() const;
+
+    /**
+     * @brief (experimental) Set the size up to which allocations of get_allocator() are served by memory pools
+     *
+     * Every thread that runs the GrpcContext keeps pools of memory blocks in size classes of powers of two from 32
+     * bytes to 64 KiB. Allocations that fall into a size class above the configured size are allocated individually
+     * from the global heap instead. Allocations larger than 64 KiB always use the global heap. The size is rounded up
+     * to the next size class. Blocks that are already pooled remain pooled until the memory resources are trimmed,
+     * see trim_memory_resources().
+     *
+     * Larger pools trade memory for fewer global heap allocations, e.g. for completion handlers with large captures.
+     * Allocations that are larger aligned than `alignof(std::max_align_t)` are served from the pools as well and
+     * occupy the size class of their size plus their alignment.
+     *
+     * Default: 1024
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void set_max_pooled_allocation_size(std::size_t size) noexcept;
+
+    /**
+     * @brief (experimental) Get the size set by set_max_pooled_allocation_size() rounded up to its size class
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] std::size_t max_pooled_allocation_size() const noexcept;
+
+    /**
+     * @brief (experimental) Return memory of idle chunks of the memory resources behind get_allocator() to the heap
+     *
+     * The memory resources only ever grow to accommodate the peak number of concurrent allocations. This function
+     * releases all chunks of memory that do not contain allocated blocks, e.g. after a traffic spike. Resources that
+     * are not in use are trimmed immediately. Resources that are in use by a thread that runs the GrpcContext, or that
+     * a thread keeps aside for its next run, are trimmed by that thread before it processes its next unit of work.
+     *
+     * To let the resources decay automatically, call this function periodically, e.g. from a PeriodicTimer.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    void trim_memory_resources();
+
     /**
      * @brief Get the underlying `grpc::CompletionQueue`
      *
@@ -320,7 +645,6 @@ class GrpcContext
   private:
     using RemoteWorkQueue = detail::AtomicIntrusiveQueue<detail::QueueableOperationBase>;
     using LocalWorkQueue = detail::IntrusiveQueue<detail::QueueableOperationBase>;
-    using MemoryResources = detail::IntrusiveStack<detail::ListablePoolResource>;
 
     template <bool>
     friend struct detail::GrpcContextThreadContextImpl;
@@ -333,16 +657,34 @@ class GrpcContext
     bool run_until_impl(::gpr_timespec deadline);
 
     grpc::Alarm work_alarm_;
-    std::atomic_long outstanding_work_{};
     std::atomic_bool stopped_{false};
     bool shutdown_{false};
     bool local_check_remote_work_{false};
     const bool multithreaded_{false};
+    const std::size_t concurrency_hint_;
     LocalWorkQueue local_work_queue_{};
+    LocalWorkQueue local_high_priority_work_queue_{};
     std::unique_ptr<grpc::CompletionQueue> completion_queue_;
-    RemoteWorkQueue remote_work_queue_{false};
-    std::mutex memory_resources_mutex_;
-    MemoryResources memory_resources_;
+
+    // Written by all threads that start or finish work, go to sleep and submit remote work respectively. Keep them away
+    // from the members above which are read on every iteration of the run*() functions.
+    alignas(detail::CACHE_LINE_SIZE) std::atomic_long outstanding_work_{};
+    alignas(detail::CACHE_LINE_SIZE) std::atomic_size_t busy_thread_count_{};
+    alignas(detail::CACHE_LINE_SIZE) RemoteWorkQueue remote_work_queue_{false};
+    RemoteWorkQueue remote_high_priority_work_queue_{true};
+    alignas(detail::CACHE_LINE_SIZE) mutable std::mutex memory_resources_mutex_;
+    detail::ListablePoolResource* created_memory_resources_{};
+    const std::uint64_t memory_resources_owner_id_{detail::next_pool_resource_owner_id()};
+    std::atomic_uint64_t memory_resources_trim_epoch_{};
+    std::atomic_size_t largest_pooled_block_size_{detail::DEFAULT_LARGEST_POOLED_BLOCK_SIZE};
+    std::atomic_size_t completion_queue_batch_size_{1};
+    std::atomic_size_t local_work_budget_{};
+    std::atomic<std::chrono::nanoseconds::rep> busy_poll_duration_{};
+    detail::BusyPollCounters busy_poll_counters_;
+    detail::QueueDelayCounters queue_delay_counters_;
+    std::atomic<std::chrono::nanoseconds::rep> alarm_resolution_{};
+    std::atomic<detail::AlarmTimerWheel*> alarm_timer_wheel_{};
+    detail::WorkStealingHook* work_stealing_hook_{};
 };
 
 AGRPC_NAMESPACE_END
@@ -0,0 +1,204 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_GRPC_CONTEXT_POOL_HPP
+#define AGRPC_AGRPC_GRPC_CONTEXT_POOL_HPP
+
+#include <agrpc/detail/forward.hpp>
+#include <agrpc/grpc_context.hpp>
+#include <agrpc/grpc_executor.hpp>
+#include <grpcpp/server_builder.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) A fixed-size pool of GrpcContexts, each run by its own thread
+ *
+ * Replaces the common pattern of creating one GrpcContext and one thread per CPU core by hand. The pool keeps every
+ * GrpcContext alive until join() or stop() is called.
+ *
+ * When work stealing is enabled, a busy GrpcContext shares its queued completion handlers with the other GrpcContexts
+ * of the pool and wakes up the thread of an idle one. Threads also look for shared completion handlers before they go
+ * to sleep. This prevents completion handlers of unequal cost from keeping some threads busy while others are idle.
+ * Completion queue events are always handled by the thread of their GrpcContext and a stopped GrpcContext is never
+ * stolen from. Work stealing is off by default because it gives up the implicit strand of a GrpcContext that is run
+ * by a single thread.
+ *
+ * Example:
+ *
+ * @code{cpp}
+ * grpc::ServerBuilder builder;
+ * agrpc::GrpcContextPool pool{builder, std::thread::hardware_concurrency(), true};
+ * // add services
+ * auto server = builder.BuildAndStart();
+ * for (std::size_t i{}; i != pool.size(); ++i)
+ * {
+ *     agrpc::register_callback_rpc_handler<RPC>(pool.get_context(i), service, handler, completion_handler);
+ * }
+ * pool.start();
+ * @endcode
+ *
+ * @attention Make sure to destruct the pool before destructing the *grpc::Server*.
+ *
+ * @since 3.8.0
+ */
+class GrpcContextPool
+{
+  public:
+    /**
+     * @brief The executor type returned by get_executor()
+     */
+    using executor_type = agrpc::GrpcContext::executor_type;
+
+    /**
+     * @brief Construct a pool of GrpcContexts for gRPC clients
+     *
+     * @arg size Number of GrpcContexts and threads, must be greater than zero
+     * @arg work_stealing Whether idle threads should execute work of other GrpcContexts in the pool
+     *
+     * @attention With work stealing, the queued completion handlers of a GrpcContext may run on another thread of the
+     * pool concurrently with the handlers that run on the thread of the GrpcContext. Code that relies on one thread per
+     * GrpcContext for synchronization must use explicit strands or leave work stealing disabled.
+     */
+    explicit GrpcContextPool(std::size_t size, bool work_stealing = false);
+
+    /**
+     * @brief Construct a pool of GrpcContexts for gRPC servers
+     *
+     * Adds one `grpc::ServerCompletionQueue` per GrpcContext to the builder. The resulting GrpcContexts can also be
+     * used for clients.
+     *
+     * @arg size Number of GrpcContexts and threads, must be greater than zero
+     * @arg work_stealing Whether idle threads should execute work of other GrpcContexts in the pool
+     *
+     * @attention With work stealing, the queued completion handlers of a GrpcContext may run on another thread of the
+     * pool concurrently with the handlers that run on the thread of the GrpcContext. Code that relies on one thread per
+     * GrpcContext for synchronization must use explicit strands or leave work stealing disabled.
+     */
+    GrpcContextPool(grpc::ServerBuilder& builder, std::size_t size, bool work_stealing = false);
+
+    GrpcContextPool(const GrpcContextPool&) = delete;
+    GrpcContextPool(GrpcContextPool&&) = delete;
+    GrpcContextPool& operator=(const GrpcContextPool&) = delete;
+    GrpcContextPool& operator=(GrpcContextPool&&) = delete;
+
+    /**
+     * @brief Destruct the pool
+     *
+     * Calls stop() and join(). Pending completion handlers will not be invoked.
+     */
+    ~GrpcContextPool();
+
+    /**
+     * @brief Start one thread per GrpcContext
+     *
+     * For servers, this function should be called after `grpc::ServerBuilder::BuildAndStart()`.
+     *
+     * @attention Must be called at most once.
+     */
+    void start();
+
+    /**
+     * @brief Signal all GrpcContexts to stop
+     *
+     * Thread-safe
+     */
+    void stop();
+
+    /**
+     * @brief Wait for all threads to finish
+     *
+     * Allows the GrpcContexts to run out of work and then blocks until all threads have exited. With work stealing,
+     * threads keep helping the other GrpcContexts until all of them ran out of work.
+     *
+     * @attention Must not be called from within a thread of this pool.
+     */
+    void join();
+
+    /**
+     * @brief Number of GrpcContexts in this pool
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /**
+     * @brief Get a GrpcContext by index
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] agrpc::GrpcContext& get_context(std::size_t index) noexcept;
+
+    /**
+     * @brief Get the next GrpcContext in round-robin order
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] agrpc::GrpcContext& next_context() noexcept;
+
+    /**
+     * @brief Get the GrpcContext with the least amount of outstanding work
+     *
+     * The amount of outstanding work is a snapshot and might have changed by the time this function returns. It is
+     * also approximate: work that a completion handler starts on its own GrpcContext is only counted once the handler
+     * returns.
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] agrpc::GrpcContext& least_loaded_context() noexcept;
+
+    /**
+     * @brief Get the executor of the next GrpcContext in round-robin order
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] executor_type get_executor() noexcept;
+
+    /**
+     * @brief Get the executor of the GrpcContext with the least amount of outstanding work
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] executor_type get_least_loaded_executor() noexcept;
+
+  private:
+    void run(agrpc::GrpcContext& grpc_context);
+
+    void enable_work_stealing();
+
+    // Declared before the GrpcContexts because their destructors may complete the steal operations and take back the
+    // shared work of the stealers
+    std::unique_ptr<detail::GrpcContextPoolStealer[]> stealers_;
+    std::vector<std::unique_ptr<agrpc::GrpcContext>> grpc_contexts_;
+    std::vector<std::thread> threads_;
+    std::atomic_size_t next_{};
+    std::atomic_size_t running_threads_{};
+    std::atomic_bool stopped_{false};
+    bool joined_{false};
+};
+
+AGRPC_NAMESPACE_END
+
+#include <agrpc/detail/grpc_context_pool.hpp>
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_GRPC_CONTEXT_POOL_HPP
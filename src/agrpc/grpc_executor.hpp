@@ -33,6 +33,94 @@
 
 AGRPC_NAMESPACE_BEGIN()
 
+/**
+ * @brief (experimental) Executor property for the priority of submitted completion handlers
+ *
+ * Completion handlers that are submitted through an executor with high priority run before all completion handlers
+ * with normal priority that have not started yet, including those that have been submitted earlier. Use it for
+ * latency-critical continuations and leave background work, like metrics flushing, at normal priority. Executors have
+ * normal priority by default.
+ *
+ * The priority only affects completion handlers submitted through `asio::post`, `asio::dispatch`, `asio::defer` and
+ * `asio::execution::execute`. It has no effect on the order in which `grpc::CompletionQueue` events are handled.
+ *
+ * Example:
+ *
+ * @code{cpp}
+ * auto executor = asio::require(grpc_context.get_executor(), agrpc::priority.high);
+ * asio::post(executor, []{});
+ * @endcode
+ *
+ * @since 3.8.0
+ */
+struct Priority
+{
+    /**
+     * @brief Property for normal priority
+     */
+    struct Normal
+    {
+        template <class T>
+        static constexpr bool is_applicable_property_v = true;
+
+        static constexpr bool is_requirable = true;
+        static constexpr bool is_preferable = true;
+
+        using polymorphic_query_result_type = agrpc::Priority;
+    };
+
+    /**
+     * @brief Property for high priority
+     */
+    struct High
+    {
+        template <class T>
+        static constexpr bool is_applicable_property_v = true;
+
+        static constexpr bool is_requirable = true;
+        static constexpr bool is_preferable = true;
+
+        using polymorphic_query_result_type = agrpc::Priority;
+    };
+
+    template <class T>
+    static constexpr bool is_applicable_property_v = true;
+
+    static constexpr bool is_requirable = false;
+    static constexpr bool is_preferable = false;
+
+    using polymorphic_query_result_type = agrpc::Priority;
+
+    static constexpr Normal normal{};
+    static constexpr High high{};
+
+    constexpr Priority() = default;
+
+    constexpr Priority(Normal) noexcept {}
+
+    constexpr Priority(High) noexcept : is_high_{true} {}
+
+    [[nodiscard]] friend constexpr bool operator==(const Priority& lhs, const Priority& rhs) noexcept
+    {
+        return lhs.is_high_ == rhs.is_high_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const Priority& lhs, const Priority& rhs) noexcept
+    {
+        return lhs.is_high_ != rhs.is_high_;
+    }
+
+  private:
+    bool is_high_{};
+};
+
+/**
+ * @brief (experimental) Property object for the priority of submitted completion handlers
+ *
+ * @since 3.8.0
+ */
+inline constexpr agrpc::Priority priority{};
+
 /**
  * @brief GrpcContext's executor
  *
@@ -190,7 +278,7 @@ class BasicGrpcExecutor
     template <class Function, class OtherAllocator>
     void dispatch(Function&& function, const OtherAllocator& other_allocator) const
     {
-        detail::create_and_submit_no_arg_operation<false>(
+        detail::create_and_submit_no_arg_operation<false, detail::is_high_priority(Options)>(
             context(), detail::AllocatorBinder(other_allocator, static_cast<Function&&>(function)));
     }
 
@@ -208,7 +296,7 @@ class BasicGrpcExecutor
     template <class Function, class OtherAllocator>
     void post(Function&& function, const OtherAllocator& other_allocator) const
     {
-        detail::create_and_submit_no_arg_operation<true>(
+        detail::create_and_submit_no_arg_operation<true, detail::is_high_priority(Options)>(
             context(), detail::AllocatorBinder(other_allocator, static_cast<Function&&>(function)));
     }
 
@@ -226,7 +314,7 @@ class BasicGrpcExecutor
     template <class Function, class OtherAllocator>
     void defer(Function&& function, const OtherAllocator& other_allocator) const
     {
-        detail::create_and_submit_no_arg_operation<true>(
+        detail::create_and_submit_no_arg_operation<true, detail::is_high_priority(Options)>(
             context(), detail::AllocatorBinder(other_allocator, static_cast<Function&&>(function)));
     }
 #endif
@@ -242,12 +330,14 @@ class BasicGrpcExecutor
     {
         if constexpr (detail::IS_STD_ALLOCATOR<Allocator>)
         {
-            detail::create_and_submit_no_arg_operation<detail::is_blocking_never(Options)>(
+            detail::create_and_submit_no_arg_operation<detail::is_blocking_never(Options),
+                                                       detail::is_high_priority(Options)>(
                 *this->grpc_context(), static_cast<Function&&>(function));
         }
         else
         {
-            detail::create_and_submit_no_arg_operation<detail::is_blocking_never(Options)>(
+            detail::create_and_submit_no_arg_operation<detail::is_blocking_never(Options),
+                                                       detail::is_high_priority(Options)>(
                 *this->grpc_context(), detail::AllocatorBinder(this->allocator(), static_cast<Function&&>(function)));
         }
     }
@@ -268,6 +358,63 @@ class BasicGrpcExecutor
                                                  detail::ScheduleSenderImplementation{});
     }
 
+    /**
+     * @brief (experimental) Obtain an executor with normal priority
+     *
+     * Do not call this function directly. It is intended to be used by the
+     * [asio::require](https://www.boost.org/doc/libs/1_86_0/doc/html/boost_asio/reference/require.html) customisation
+     * point.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] constexpr auto require(agrpc::Priority::Normal) const noexcept
+        -> agrpc::BasicGrpcExecutor<Allocator, detail::set_high_priority(Options, false)>
+    {
+        return {*this->grpc_context(), this->allocator()};
+    }
+
+    /**
+     * @brief (experimental) Obtain an executor with high priority
+     *
+     * Do not call this function directly. It is intended to be used by the
+     * [asio::require](https://www.boost.org/doc/libs/1_86_0/doc/html/boost_asio/reference/require.html) customisation
+     * point.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] constexpr auto require(agrpc::Priority::High) const noexcept
+        -> agrpc::BasicGrpcExecutor<Allocator, detail::set_high_priority(Options, true)>
+    {
+        return {*this->grpc_context(), this->allocator()};
+    }
+
+    /**
+     * @brief (experimental) Query the current value of the priority property
+     *
+     * Do not call this function directly. It is intended to be used by the
+     * [asio::query](https://www.boost.org/doc/libs/1_86_0/doc/html/boost_asio/reference/query.html) customisation
+     * point.
+     *
+     * Thread-safe
+     *
+     * @since 3.8.0
+     */
+    [[nodiscard]] static constexpr agrpc::Priority query(agrpc::Priority) noexcept
+    {
+        if constexpr (detail::is_high_priority(Options))
+        {
+            return agrpc::Priority::high;
+        }
+        else
+        {
+            return agrpc::Priority::normal;
+        }
+    }
+
 #ifdef AGRPC_STDEXEC
     constexpr auto query(stdexec::get_forward_progress_guarantee_t) const noexcept
     {
@@ -567,6 +714,24 @@ struct agrpc::asio::traits::require_member<agrpc::BasicGrpcExecutor<Allocator, O
         agrpc::BasicGrpcExecutor<Allocator, agrpc::detail::set_outstanding_work_tracked(Options, false)>;
 };
 
+template <class Allocator, std::uint32_t Options>
+struct agrpc::asio::traits::require_member<agrpc::BasicGrpcExecutor<Allocator, Options>, agrpc::Priority::Normal>
+{
+    static constexpr bool is_valid = true;
+    static constexpr bool is_noexcept = true;
+
+    using result_type = agrpc::BasicGrpcExecutor<Allocator, agrpc::detail::set_high_priority(Options, false)>;
+};
+
+template <class Allocator, std::uint32_t Options>
+struct agrpc::asio::traits::require_member<agrpc::BasicGrpcExecutor<Allocator, Options>, agrpc::Priority::High>
+{
+    static constexpr bool is_valid = true;
+    static constexpr bool is_noexcept = true;
+
+    using result_type = agrpc::BasicGrpcExecutor<Allocator, agrpc::detail::set_high_priority(Options, true)>;
+};
+
 template <class Allocator, std::uint32_t Options>
 struct agrpc::asio::traits::require_member<agrpc::BasicGrpcExecutor<Allocator, Options>,
                                            agrpc::asio::execution::allocator_t<void>>
@@ -644,6 +809,22 @@ struct agrpc::asio::traits::query_static_constexpr_member<
     : agrpc::detail::QueryStaticMapping
 {
 };
+
+template <class Allocator, std::uint32_t Options, class Property>
+struct agrpc::asio::traits::query_static_constexpr_member<
+    agrpc::BasicGrpcExecutor<Allocator, Options>, Property,
+    typename std::enable_if_t<std::is_convertible_v<Property, agrpc::Priority>>>
+{
+    static constexpr bool is_valid = true;
+    static constexpr bool is_noexcept = true;
+
+    using result_type = agrpc::Priority;
+
+    [[nodiscard]] static constexpr result_type value() noexcept
+    {
+        return agrpc::BasicGrpcExecutor<Allocator, Options>::query(agrpc::priority);
+    }
+};
 #endif
 
 #if (defined(AGRPC_BOOST_ASIO) && !defined(BOOST_ASIO_HAS_DEDUCED_QUERY_MEMBER_TRAIT)) || \
@@ -0,0 +1,210 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_PERIODIC_TIMER_HPP
+#define AGRPC_AGRPC_PERIODIC_TIMER_HPP
+
+#include <agrpc/detail/default_completion_token.hpp>
+#include <agrpc/detail/initiate_sender_implementation.hpp>
+#include <agrpc/detail/periodic_timer.hpp>
+#include <agrpc/detail/query_grpc_context.hpp>
+#include <agrpc/grpc_executor.hpp>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) I/O object for waiting on periodic deadlines
+ *
+ * Expires at `first_expiry + n * period`. Deadlines are absolute, so the time it takes to observe an expiry and to
+ * start the next wait does not accumulate. If the timer falls behind, e.g. because the GrpcContext was busy, the
+ * next wait skips the expiries that already passed and reports their number.
+ *
+ * Waits use a grpc::Alarm or, if enabled, the timer wheel of the GrpcContext, see
+ * GrpcContext::set_alarm_resolution(). The memory of the operation is reused across consecutive waits unless the
+ * completion handler has an associated allocator.
+ *
+ * @tparam Executor The executor type, must be capable of referring to a GrpcContext.
+ *
+ * **Per-Operation Cancellation**
+ *
+ * All. The operation completes with `false`.
+ *
+ * @attention The BasicPeriodicTimer must not outlive its GrpcContext.
+ *
+ * @since 3.8.0
+ */
+template <class Executor>
+class BasicPeriodicTimer
+{
+  public:
+    /**
+     * @brief The executor type
+     */
+    using executor_type = Executor;
+
+    /**
+     * @brief The clock type
+     */
+    using clock_type = std::chrono::system_clock;
+
+    /**
+     * @brief The duration type
+     */
+    using duration = clock_type::duration;
+
+    /**
+     * @brief The time point type
+     */
+    using time_point = clock_type::time_point;
+
+    /**
+     * @brief Construct a BasicPeriodicTimer from an executor that first expires one period from now
+     *
+     * @param period Must be greater than zero
+     */
+    BasicPeriodicTimer(const Executor& executor, duration period)
+        : BasicPeriodicTimer(executor, period, clock_type::now() + period)
+    {
+    }
+
+    /**
+     * @brief Construct a BasicPeriodicTimer from an executor that first expires at `first_expiry`
+     *
+     * @param period Must be greater than zero
+     */
+    BasicPeriodicTimer(const Executor& executor, duration period, time_point first_expiry)
+        : executor_(executor), state_(new detail::PeriodicTimerState(first_expiry, period))
+    {
+    }
+
+    /**
+     * @brief Construct a BasicPeriodicTimer from a GrpcContext that first expires one period from now
+     *
+     * @param period Must be greater than zero
+     */
+    BasicPeriodicTimer(agrpc::GrpcContext& grpc_context, duration period)
+        : BasicPeriodicTimer(grpc_context.get_executor(), period)
+    {
+    }
+
+    /**
+     * @brief Construct a BasicPeriodicTimer from a GrpcContext that first expires at `first_expiry`
+     *
+     * @param period Must be greater than zero
+     */
+    BasicPeriodicTimer(agrpc::GrpcContext& grpc_context, duration period, time_point first_expiry)
+        : BasicPeriodicTimer(grpc_context.get_executor(), period, first_expiry)
+    {
+    }
+
+    BasicPeriodicTimer(const BasicPeriodicTimer&) = delete;
+    BasicPeriodicTimer(BasicPeriodicTimer&&) = delete;
+
+    /**
+     * @brief Destruct the BasicPeriodicTimer
+     *
+     * An outstanding wait completes with `false` if the timer did not expire yet.
+     */
+    ~BasicPeriodicTimer() = default;
+
+    BasicPeriodicTimer& operator=(const BasicPeriodicTimer&) = delete;
+    BasicPeriodicTimer& operator=(BasicPeriodicTimer&&) = delete;
+
+    /**
+     * @brief Wait for the next expiry
+     *
+     * Completes once expiry() has been reached or the wait was cancelled. Upon expiry, expiry() advances to the next
+     * deadline in the future before the completion handler is invoked. A cancelled wait does not change expiry().
+     *
+     * @attention Only one wait may be outstanding at a time.
+     *
+     * @param token A completion token like `asio::yield_context` or the one created by `agrpc::use_sender`. The
+     * completion signature is `void(bool, std::size_t)`. `true` if it expired, `false` if it was cancelled. The second
+     * argument is the number of expiries that passed before this one was observed and that were skipped. For
+     * `agrpc::use_sender` the completion signature is `void(std::size_t)` and cancellation completes with
+     * `set_done`/`set_stopped`.
+     */
+    template <class CompletionToken = detail::DefaultCompletionTokenT<Executor>>
+    auto wait(CompletionToken&& token = CompletionToken{})
+    {
+        return detail::async_initiate_periodic_timer_wait(
+            grpc_context(), detail::PeriodicTimerInitiation{{alarm_, timer_wheel_handle_, state_->expiry_}}, state_,
+            static_cast<CompletionToken&&>(token));
+    }
+
+    /**
+     * @brief Cancel an outstanding wait
+     *
+     * The outstanding wait will complete with `false` if the timer did not expire yet, otherwise this function has no
+     * effect.
+     *
+     * Thread-safe
+     */
+    void cancel() { detail::cancel_alarm(alarm_, timer_wheel_handle_); }
+
+    /**
+     * @brief Get the period
+     */
+    [[nodiscard]] duration period() const noexcept { return state_->period_; }
+
+    /**
+     * @brief Get the next expiry
+     */
+    [[nodiscard]] time_point expiry() const noexcept { return state_->expiry_; }
+
+    /**
+     * @brief Get the executor
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] const executor_type& get_executor() const noexcept { return executor_; }
+
+    /**
+     * @brief Get the scheduler
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] const executor_type& get_scheduler() const noexcept { return executor_; }
+
+  private:
+    auto& grpc_context() const noexcept { return detail::query_grpc_context(executor_); }
+
+    Executor executor_;
+    detail::PeriodicTimerStatePtr state_;
+    grpc::Alarm alarm_;
+    detail::AlarmTimerWheelHandle timer_wheel_handle_;
+};
+
+template <class = void>
+BasicPeriodicTimer(agrpc::GrpcContext&, std::chrono::system_clock::duration)
+    -> BasicPeriodicTimer<agrpc::GrpcExecutor>;
+
+template <class = void>
+BasicPeriodicTimer(agrpc::GrpcContext&, std::chrono::system_clock::duration, std::chrono::system_clock::time_point)
+    -> BasicPeriodicTimer<agrpc::GrpcExecutor>;
+
+/**
+ * @brief A BasicPeriodicTimer that uses `agrpc::GrpcExecutor`
+ *
+ * @since 3.8.0
+ */
+using PeriodicTimer = agrpc::BasicPeriodicTimer<agrpc::GrpcExecutor>;
+
+AGRPC_NAMESPACE_END
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_PERIODIC_TIMER_HPP
@@ -0,0 +1,122 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_POOLED_MESSAGE_FACTORY_HPP
+#define AGRPC_AGRPC_POOLED_MESSAGE_FACTORY_HPP
+
+#include <agrpc/detail/pooled_message_factory.hpp>
+#include <agrpc/detail/utility.hpp>
+#include <agrpc/grpc_context.hpp>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) Message factory that obtains memory from the pools of the GrpcContext
+ *
+ * Can be returned from the `request_message_factory()` and `response_message_factory()` of a rpc handler that is
+ * passed to one of the `register_*_rpc_handler` functions. Messages are allocated using GrpcContext::get_allocator()
+ * and therefore typically without a call to the global heap. Unlike agrpc::BasicRPCArena, the memory of a message can
+ * be reused right after it is destroyed, which makes it a good fit for long-lived streaming RPCs.
+ *
+ * Messages that have not been destroyed explicitly are destroyed when the factory is destructed.
+ *
+ * @attention The factory must be destructed before the GrpcContext.
+ *
+ * @since 3.8.0
+ */
+class PooledMessageFactory
+{
+  public:
+    /**
+     * @brief Default construct
+     */
+    PooledMessageFactory() = default;
+
+    PooledMessageFactory(const PooledMessageFactory&) = delete;
+    PooledMessageFactory(PooledMessageFactory&&) = delete;
+    PooledMessageFactory& operator=(const PooledMessageFactory&) = delete;
+    PooledMessageFactory& operator=(PooledMessageFactory&&) = delete;
+
+    /**
+     * @brief Destruct all messages that have not been destroyed yet
+     */
+    ~PooledMessageFactory() noexcept
+    {
+        while (head_ != nullptr)
+        {
+            auto* node = head_;
+            head_ = node->next_;
+            node->destroy_(node);
+        }
+    }
+
+    /**
+     * @brief Create a message
+     */
+    template <class T, class... Args>
+    T& create(Args&&... args)
+    {
+        using Storage = detail::PooledMessageStorage<T>;
+        detail::PoolResourceAllocator<Storage> allocator;
+        auto* const storage = allocator.allocate(1);
+        detail::ScopeGuard guard{[&]
+                                 {
+                                     allocator.deallocate(storage, 1);
+                                 }};
+        auto* const message = ::new (static_cast<void*>(storage->data_ + Storage::MESSAGE_OFFSET))
+            T(static_cast<Args&&>(args)...);
+        guard.release();
+        auto* const node = ::new (static_cast<void*>(storage->data_))
+            detail::PooledMessageNode{nullptr, head_, &Storage::destroy};
+        if (head_ != nullptr)
+        {
+            head_->previous_ = node;
+        }
+        head_ = node;
+        return *message;
+    }
+
+    /**
+     * @brief Destroy a message that was created by this factory
+     */
+    template <class T>
+    void destroy(T& message) noexcept
+    {
+        auto& node = detail::PooledMessageStorage<T>::node(message);
+        if (node.previous_ != nullptr)
+        {
+            node.previous_->next_ = node.next_;
+        }
+        else
+        {
+            head_ = node.next_;
+        }
+        if (node.next_ != nullptr)
+        {
+            node.next_->previous_ = node.previous_;
+        }
+        node.destroy_(&node);
+    }
+
+  private:
+    detail::PooledMessageNode* head_{};
+};
+
+AGRPC_NAMESPACE_END
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_POOLED_MESSAGE_FACTORY_HPP
@@ -44,6 +44,15 @@ AGRPC_NAMESPACE_BEGIN()
  *
  * @snippet server_rpc.cpp server-rpc-handler-with-arena
  *
+ * [(experimental) The rpc handler may also have a method called `response_message_factory()`. If it does then that
+ * method will be invoked for every rpc and the returned object passed to the rpc handler as its last argument. The
+ * object lives until the rpc ends and is meant for creating response messages, e.g. agrpc::PooledMessageFactory or
+ * agrpc::RPCArena.
+ *
+ * Example: (since 3.8.0)]
+ *
+ * @snippet server_rpc.cpp server-rpc-handler-with-response-message-factory
+ *
  * @tparam ServerRPC An instantiation of `agrpc::ServerRPC`
  * @param grpc_context The GrpcContext used to handle each rpc
  * @param service The service associated with the gRPC method of the ServerRPC
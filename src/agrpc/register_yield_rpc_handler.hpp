@@ -51,6 +51,26 @@ AGRPC_NAMESPACE_BEGIN()
  *
  * @snippet server_rpc.cpp server-rpc-handler-with-arena
  *
+ * [(experimental) If the returned object also has a method called `get_allocator()`, like agrpc::RPCArena, then the
+ * operations that are initiated on behalf of the rpc, e.g. waiting for the request, obtain their memory from that
+ * allocator.
+ *
+ * Example: (since 3.8.0)]
+ *
+ * @snippet server_rpc.cpp server-rpc-handler-with-rpc-arena
+ *
+ * [(experimental) The rpc handler may also have a method called `response_message_factory()`. If it does then that
+ * method will be invoked for every rpc and the returned object passed to the rpc handler as its last argument. The
+ * object lives until the rpc ends and is meant for creating response messages, e.g. agrpc::PooledMessageFactory or
+ * agrpc::RPCArena.
+ *
+ * Example: (since 3.8.0)]
+ *
+ * @snippet server_rpc.cpp server-rpc-handler-with-response-message-factory
+ *
+ * (experimental) The stacks of the coroutines are obtained from the agrpc::StackPool of the GrpcContext, which keeps
+ * the stacks of finished rpcs for reuse. (since 3.8.0)
+ *
  * @tparam ServerRPC An instantiation of `agrpc::ServerRPC`
  * @param executor The executor used to handle each rpc
  * @param service The service associated with the gRPC method of the ServerRPC
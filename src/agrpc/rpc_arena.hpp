@@ -0,0 +1,193 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_RPC_ARENA_HPP
+#define AGRPC_AGRPC_RPC_ARENA_HPP
+
+#include <agrpc/detail/bind_allocator.hpp>
+#include <agrpc/detail/forward.hpp>
+#include <agrpc/detail/rpc_arena.hpp>
+#include <agrpc/detail/utility.hpp>
+
+#include <cstddef>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) Allocator that obtains memory from an agrpc::BasicRPCArena
+ *
+ * Deallocation is a no-op, the memory is released when the arena is destructed.
+ *
+ * @since 3.8.0
+ */
+template <class T>
+class RPCArenaAllocator
+{
+  public:
+    /**
+     * @brief The value type
+     */
+    using value_type = T;
+
+    /**
+     * @brief Construct from another RPCArenaAllocator
+     */
+    template <class U>
+    RPCArenaAllocator(const agrpc::RPCArenaAllocator<U>& other) noexcept : resource_(other.resource_)
+    {
+    }
+
+    /**
+     * @brief Allocate memory for `n` objects of type `T`
+     */
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief No-op
+     */
+    void deallocate(T*, std::size_t) noexcept {}
+
+    template <class U>
+    friend bool operator==(const RPCArenaAllocator& lhs, const agrpc::RPCArenaAllocator<U>& rhs) noexcept
+    {
+        return lhs.resource_ == rhs.resource_;
+    }
+
+    template <class U>
+    friend bool operator!=(const RPCArenaAllocator& lhs, const agrpc::RPCArenaAllocator<U>& rhs) noexcept
+    {
+        return lhs.resource_ != rhs.resource_;
+    }
+
+  private:
+    template <class>
+    friend class agrpc::RPCArenaAllocator;
+
+    template <std::size_t>
+    friend class agrpc::BasicRPCArena;
+
+    explicit RPCArenaAllocator(detail::RPCArenaResource& resource) noexcept : resource_(&resource) {}
+
+    detail::RPCArenaResource* resource_;
+};
+
+/**
+ * @brief (experimental) Monotonic arena for all memory of a single RPC
+ *
+ * Meant to be returned from the `request_message_factory()` or `response_message_factory()` of a rpc handler that is
+ * passed to one of the `register_*_rpc_handler` functions. The arena is then owned by the RPC and destructed, together
+ * with all objects created from it, once the RPC ends. Besides the request message it also provides the memory for the
+ * operations that the library initiates on behalf of the RPC, like waiting for the RPC to be started and
+ * `wait_for_done`.
+ * Response messages can be created using `create()` and memory for user-initiated operations can be obtained by
+ * binding the arena's allocator to their completion token, see `bind_allocator()`.
+ *
+ * The first `InlineSize` bytes are stored inline, typically as part of the allocation of the RPC itself. Once those
+ * are exhausted, memory is obtained from the global heap in chunks of increasing size. Overall, a unary RPC can
+ * complete without any further memory allocation if `InlineSize` is large enough.
+ *
+ * The arena is not thread-safe. Operations of the RPC must therefore not be initiated concurrently.
+ *
+ * @tparam InlineSize Number of bytes to store inline.
+ *
+ * @since 3.8.0
+ */
+template <std::size_t InlineSize>
+class BasicRPCArena
+{
+  public:
+    /**
+     * @brief The allocator type
+     */
+    using allocator_type = agrpc::RPCArenaAllocator<std::byte>;
+
+    /**
+     * @brief Default construct
+     */
+    BasicRPCArena() noexcept : resource_(buffer_, InlineSize) {}
+
+    BasicRPCArena(const BasicRPCArena&) = delete;
+    BasicRPCArena(BasicRPCArena&&) = delete;
+    BasicRPCArena& operator=(const BasicRPCArena&) = delete;
+    BasicRPCArena& operator=(BasicRPCArena&&) = delete;
+
+    /**
+     * @brief Create an object in the arena
+     *
+     * The object is destructed when the arena is destructed.
+     */
+    template <class T, class... Args>
+    T& create(Args&&... args)
+    {
+        return resource_.template create<T>(static_cast<Args&&>(args)...);
+    }
+
+    /**
+     * @brief Allocate memory from the arena
+     */
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        return resource_.allocate(size, alignment);
+    }
+
+    /**
+     * @brief Get an allocator that obtains memory from this arena
+     */
+    [[nodiscard]] allocator_type get_allocator() noexcept { return allocator_type{resource_}; }
+
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+    /**
+     * @brief Bind the allocator of this arena to a completion token
+     *
+     * Example:
+     *
+     * @code{cpp}
+     * rpc.finish(response, grpc::Status::OK, arena.bind_allocator(asio::use_awaitable));
+     * @endcode
+     */
+    template <class CompletionToken>
+    [[nodiscard]] auto bind_allocator(CompletionToken&& token)
+    {
+        return detail::AllocatorBinder<detail::RemoveCrefT<CompletionToken>, allocator_type>(
+            get_allocator(), static_cast<CompletionToken&&>(token));
+    }
+#endif
+
+    /**
+     * @brief Number of bytes that have been handed out by this arena
+     */
+    [[nodiscard]] std::size_t space_used() const noexcept { return resource_.space_used(); }
+
+  private:
+    alignas(std::max_align_t) std::byte buffer_[InlineSize];
+    detail::RPCArenaResource resource_;
+};
+
+/**
+ * @brief (experimental) A BasicRPCArena that stores 1024 bytes inline
+ *
+ * @since 3.8.0
+ */
+using RPCArena = agrpc::BasicRPCArena<1024>;
+
+AGRPC_NAMESPACE_END
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_RPC_ARENA_HPP
@@ -19,6 +19,7 @@
 #include <agrpc/detail/default_completion_token.hpp>
 #include <agrpc/detail/initiate_sender_implementation.hpp>
 #include <agrpc/detail/name.hpp>
+#include <agrpc/detail/operation_slot.hpp>
 #include <agrpc/detail/rpc_type.hpp>
 #include <agrpc/detail/server_rpc_base.hpp>
 #include <agrpc/detail/server_rpc_sender.hpp>
@@ -236,7 +237,8 @@ template <class ServiceT, class RequestT, class ResponseT,
           detail::ServerClientStreamingRequest<ServiceT, RequestT, ResponseT> RequestClientStreaming, class TraitsT,
           class Executor>
 class ServerRPC<RequestClientStreaming, TraitsT, Executor>
-    : public detail::ServerRPCBase<grpc::ServerAsyncReader<ResponseT, RequestT>, TraitsT, Executor>
+    : public detail::ServerRPCBase<grpc::ServerAsyncReader<ResponseT, RequestT>, TraitsT, Executor>,
+      private detail::RPCOperationSlot
 {
   private:
     using Responder = grpc::ServerAsyncReader<ResponseT, RequestT>;
@@ -336,7 +338,7 @@ class ServerRPC<RequestClientStreaming, TraitsT, Executor>
     auto read(RequestT& req, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerReadSenderInitiation<Responder>{*this, req},
+            this->grpc_context(), this->operation_slot(), detail::ServerReadSenderInitiation<Responder>{*this, req},
             detail::ServerReadSenderImplementation{}, static_cast<CompletionToken&&>(token));
     }
 
@@ -369,7 +371,8 @@ class ServerRPC<RequestClientStreaming, TraitsT, Executor>
     auto finish(const ResponseT& response, const grpc::Status& status, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerFinishWithMessageInitation<Response>{response, status},
+            this->grpc_context(), this->operation_slot(),
+            detail::ServerFinishWithMessageInitation<Response>{response, status},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -399,7 +402,7 @@ class ServerRPC<RequestClientStreaming, TraitsT, Executor>
     auto finish_with_error(const grpc::Status& status, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerFinishWithErrorSenderInitation{status},
+            this->grpc_context(), this->operation_slot(), detail::ServerFinishWithErrorSenderInitation{status},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -439,7 +442,8 @@ template <class ServiceT, class RequestT, class ResponseT,
           detail::ServerServerStreamingRequest<ServiceT, RequestT, ResponseT> RequestServerStreaming, class TraitsT,
           class Executor>
 class ServerRPC<RequestServerStreaming, TraitsT, Executor>
-    : public detail::ServerRPCBase<grpc::ServerAsyncWriter<ResponseT>, TraitsT, Executor>
+    : public detail::ServerRPCBase<grpc::ServerAsyncWriter<ResponseT>, TraitsT, Executor>,
+      private detail::RPCOperationSlot
 {
   private:
     using Responder = grpc::ServerAsyncWriter<ResponseT>;
@@ -541,7 +545,8 @@ class ServerRPC<RequestServerStreaming, TraitsT, Executor>
     auto write(const ResponseT& response, grpc::WriteOptions options, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerWriteSenderInitiation<Responder>{*this, response, options},
+            this->grpc_context(), this->operation_slot(),
+            detail::ServerWriteSenderInitiation<Responder>{*this, response, options},
             detail::ServerWriteSenderImplementation{}, static_cast<CompletionToken&&>(token));
     }
 
@@ -584,7 +589,8 @@ class ServerRPC<RequestServerStreaming, TraitsT, Executor>
                           CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerWriteAndFinishSenderInitation<Response>{response, status, options},
+            this->grpc_context(), this->operation_slot(),
+            detail::ServerWriteAndFinishSenderInitation<Response>{response, status, options},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -620,7 +626,7 @@ class ServerRPC<RequestServerStreaming, TraitsT, Executor>
     auto finish(const grpc::Status& status, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerFinishSenderInitation{status},
+            this->grpc_context(), this->operation_slot(), detail::ServerFinishSenderInitation{status},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -639,7 +645,8 @@ namespace detail
  */
 template <class RequestT, class ResponseT, template <class, class> class ResponderT, class TraitsT, class Executor>
 class ServerRPCBidiStreamingBase<ResponderT<ResponseT, RequestT>, TraitsT, Executor>
-    : public detail::ServerRPCBase<ResponderT<ResponseT, RequestT>, TraitsT, Executor>
+    : public detail::ServerRPCBase<ResponderT<ResponseT, RequestT>, TraitsT, Executor>,
+      private detail::BidiRPCOperationSlots
 {
   private:
     using Responder = ResponderT<ResponseT, RequestT>;
@@ -674,7 +681,7 @@ class ServerRPCBidiStreamingBase<ResponderT<ResponseT, RequestT>, TraitsT, Execu
     auto read(RequestT& req, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerReadSenderInitiation<Responder>{*this, req},
+            this->grpc_context(), this->read_slot(), detail::ServerReadSenderInitiation<Responder>{*this, req},
             detail::ServerReadSenderImplementation{}, static_cast<CompletionToken&&>(token));
     }
 
@@ -696,7 +703,8 @@ class ServerRPCBidiStreamingBase<ResponderT<ResponseT, RequestT>, TraitsT, Execu
     auto write(const ResponseT& response, grpc::WriteOptions options, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerWriteSenderInitiation<Responder>{*this, response, options},
+            this->grpc_context(), this->write_slot(),
+            detail::ServerWriteSenderInitiation<Responder>{*this, response, options},
             detail::ServerWriteSenderImplementation{}, static_cast<CompletionToken&&>(token));
     }
 
@@ -741,7 +749,8 @@ class ServerRPCBidiStreamingBase<ResponderT<ResponseT, RequestT>, TraitsT, Execu
                           CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerWriteAndFinishSenderInitation<Response>{response, status, options},
+            this->grpc_context(), this->write_slot(),
+            detail::ServerWriteAndFinishSenderInitation<Response>{response, status, options},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
@@ -785,7 +794,7 @@ class ServerRPCBidiStreamingBase<ResponderT<ResponseT, RequestT>, TraitsT, Execu
     auto finish(const grpc::Status& status, CompletionToken&& token = CompletionToken{})
     {
         return detail::async_initiate_sender_implementation(
-            this->grpc_context(), detail::ServerFinishSenderInitation{status},
+            this->grpc_context(), this->write_slot(), detail::ServerFinishSenderInitation{status},
             detail::ServerFinishSenderImplementation<Responder>{*this}, static_cast<CompletionToken&&>(token));
     }
 
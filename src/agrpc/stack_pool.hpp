@@ -0,0 +1,189 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_STACK_POOL_HPP
+#define AGRPC_AGRPC_STACK_POOL_HPP
+
+#include <agrpc/detail/config.hpp>
+
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+
+#include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/stack_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) Pool of coroutine stacks of an execution context
+ *
+ * An Asio service that keeps the stacks of finished stackful coroutines for reuse, so that spawning a coroutine
+ * does not need to map and unmap memory. `register_yield_rpc_handler` obtains the stacks of its coroutines from the
+ * StackPool of the GrpcContext of the ServerRPC's executor.
+ *
+ * The pool is created with default options the first time that it is used. To customize the options, create it
+ * before that:
+ *
+ * @code{cpp}
+ * asio::make_service<agrpc::StackPool>(grpc_context, agrpc::StackPool::Options{256 * 1024, true, 32});
+ * @endcode
+ *
+ * Stack allocators are only supported by `asio::spawn` since Boost 1.80 and Asio 1.24. With older versions, only
+ * the stack size is applied and the statistics remain zero.
+ *
+ * @since 3.8.0
+ */
+class StackPool : public asio::execution_context::service
+{
+  public:
+    /**
+     * @brief Options of a StackPool
+     */
+    struct Options
+    {
+        /**
+         * @brief Size of each stack in bytes, zero selects the default size of Boost.Context
+         */
+        std::size_t stack_size{};
+
+        /**
+         * @brief Whether each stack is followed by a guard page that turns stack overflows into segmentation faults
+         */
+        bool guard_page{true};
+
+        /**
+         * @brief Maximum number of unused stacks that are kept for reuse
+         */
+        std::size_t max_pooled_stacks{32};
+    };
+
+    /**
+     * @brief Statistics of a StackPool
+     */
+    struct Statistics
+    {
+        /**
+         * @brief Number of stacks handed out
+         */
+        std::uint64_t allocations;
+
+        /**
+         * @brief Number of stacks handed out that were taken from the pool instead of being newly allocated
+         *
+         * The reuse rate is `reuses / allocations`.
+         */
+        std::uint64_t reuses;
+
+        /**
+         * @brief Number of unused stacks currently kept in the pool
+         */
+        std::size_t pooled_stacks;
+    };
+
+    /**
+     * @brief Stack allocator for `asio::spawn`
+     *
+     * Models the StackAllocator concept of Boost.Context. Keeps the pool alive, so that coroutines may outlive the
+     * execution context of the pool.
+     */
+    class StackAllocator
+    {
+      public:
+        /**
+         * @brief Allocate a stack
+         */
+        [[nodiscard]] boost::context::stack_context allocate() { return pool_->allocate(); }
+
+        /**
+         * @brief Return a stack to the pool
+         */
+        void deallocate(boost::context::stack_context& stack) noexcept { pool_->deallocate(stack); }
+
+      private:
+        friend StackPool;
+
+        explicit StackAllocator(std::shared_ptr<detail::StackPool> pool) noexcept : pool_(std::move(pool)) {}
+
+        std::shared_ptr<detail::StackPool> pool_;
+    };
+
+    /**
+     * @brief The identifier of this service
+     */
+    inline static asio::execution_context::id id{};
+
+    /**
+     * @brief Construct with default options
+     */
+    explicit StackPool(asio::execution_context& context) : StackPool(context, Options{}) {}
+
+    /**
+     * @brief Construct with options
+     */
+    StackPool(asio::execution_context& context, const Options& options)
+        : asio::execution_context::service(context),
+          options_(options),
+          pool_(std::make_shared<detail::StackPool>(options.stack_size, options.guard_page, options.max_pooled_stacks))
+    {
+    }
+
+    /**
+     * @brief Get the options that this pool was constructed with
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] const Options& options() const noexcept { return options_; }
+
+    /**
+     * @brief Get a stack allocator that obtains its stacks from this pool
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] StackAllocator get_allocator() const noexcept { return StackAllocator{pool_}; }
+
+    /**
+     * @brief Size of each stack in bytes
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] std::size_t stack_size() const noexcept { return pool_->stack_size(); }
+
+    /**
+     * @brief Get the statistics of this pool
+     *
+     * Thread-safe
+     */
+    [[nodiscard]] Statistics statistics() const
+    {
+        return {pool_->allocations(), pool_->reuses(), pool_->pooled_stacks()};
+    }
+
+  private:
+    void shutdown() override {}
+
+    Options options_;
+    std::shared_ptr<detail::StackPool> pool_;
+};
+
+AGRPC_NAMESPACE_END
+
+#endif
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_STACK_POOL_HPP
@@ -0,0 +1,267 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AGRPC_AGRPC_TASK_HPP
+#define AGRPC_AGRPC_TASK_HPP
+
+#include <agrpc/detail/config.hpp>
+
+#if defined(AGRPC_STANDALONE_ASIO) || defined(AGRPC_BOOST_ASIO)
+
+#include <agrpc/detail/awaitable.hpp>
+
+#ifdef AGRPC_ASIO_HAS_CO_AWAIT
+
+#include <agrpc/detail/asio_forward.hpp>
+#include <agrpc/detail/association.hpp>
+#include <agrpc/detail/coroutine_traits.hpp>
+#include <agrpc/detail/rethrow_first_arg.hpp>
+#include <agrpc/detail/task.hpp>
+#include <agrpc/grpc_context.hpp>
+#include <agrpc/grpc_executor.hpp>
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include <agrpc/detail/config.hpp>
+
+AGRPC_NAMESPACE_BEGIN()
+
+/**
+ * @brief (experimental) Lazily started coroutine that is native to this library
+ *
+ * A lightweight alternative to `asio::awaitable`. Operations of this library, like those of agrpc::ServerRPC,
+ * agrpc::ClientRPC and agrpc::Alarm, are awaited by passing `agrpc::use_task` as their completion token. Their
+ * completion handler resumes the task directly without allocating memory or posting to the executor. Awaiting another
+ * Task transfers control to it symmetrically, which means that arbitrarily long chains of tasks that complete
+ * synchronously do not grow the stack. Coroutine frames are allocated from the memory pool of the GrpcContext of the
+ * current thread and reused when the thread does not run one.
+ *
+ * Each task has a `std::stop_token`, obtained with `co_await agrpc::this_task::stop_token`, that is shared with the
+ * tasks that it awaits. A stop request cancels the operation that the task is currently waiting for, e.g. it cancels
+ * the rpc of an agrpc::ServerRPC or agrpc::ClientRPC. This requires Asio's cancellation slots (Boost.Asio 1.77 or
+ * Asio 1.19). Stop must be requested from the thread that runs the task's executor.
+ *
+ * A Task is started by awaiting it from another Task, by `agrpc::co_spawn` or by returning it from an rpc handler
+ * registered with `agrpc::register_awaitable_rpc_handler` or with `agrpc::register_coroutine_rpc_handler` and
+ * agrpc::TaskCoroutineTraits:
+ *
+ * @snippet server_rpc.cpp server-rpc-task-handler
+ *
+ * @tparam T The type of the value produced by the task
+ * @tparam Executor The executor that operations initiated by this task complete on
+ *
+ * @since 3.8.0
+ */
+template <class T, class Executor>
+class [[nodiscard]] Task
+{
+  public:
+    /**
+     * @brief The coroutine promise type
+     */
+    using promise_type = detail::TaskPromise<T, Executor>;
+
+    /**
+     * @brief The value type
+     */
+    using value_type = T;
+
+    /**
+     * @brief The executor type
+     */
+    using executor_type = Executor;
+
+    /**
+     * @brief Move constructor
+     */
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task(const Task&) = delete;
+
+    /**
+     * @brief Move assignment operator
+     */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Destruct the coroutine if it has not been started
+     */
+    ~Task() noexcept { destroy(); }
+
+    /**
+     * @brief Start the task and wait for its result
+     *
+     * Rethrows any exception that the task exited with.
+     */
+    auto operator co_await() && noexcept { return detail::TaskAwaiter<T, Executor>{handle_}; }
+
+  private:
+    friend promise_type;
+    friend detail::TaskAccess;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    void destroy() noexcept
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief (experimental) Task completion token
+ *
+ * Causes asynchronous operations to return an object that can be awaited by an agrpc::Task. The result of the
+ * `co_await` expression is the argument of the operation's completion signature, a `std::tuple` if there are several,
+ * or `void` if there are none.
+ *
+ * @since 3.8.0
+ */
+struct UseTask
+{
+};
+
+/**
+ * @brief (experimental) Instance of the task completion token
+ *
+ * @link agrpc::UseTask
+ * Task completion token.
+ * @endlink
+ *
+ * @since 3.8.0
+ */
+inline constexpr agrpc::UseTask use_task{};
+
+namespace this_task
+{
+/**
+ * @brief (experimental) Awaitable that produces the `std::stop_token` of the current agrpc::Task
+ *
+ * @since 3.8.0
+ */
+inline constexpr detail::TaskGetStopTokenArg stop_token{};
+
+/**
+ * @brief (experimental) Awaitable that produces the executor of the current agrpc::Task
+ *
+ * @since 3.8.0
+ */
+inline constexpr detail::TaskGetExecutorArg executor{};
+}
+
+/**
+ * @brief (experimental) Spawn an agrpc::Task
+ *
+ * The task is started by posting to the executor. If the completion handler has an associated cancellation slot then
+ * emitting a cancellation signal requests stop on the task's stop token.
+ *
+ * @param executor The executor of the task
+ * @param task The task to spawn
+ * @param token A completion token for signature `void(std::exception_ptr)` or `void(std::exception_ptr, T)`
+ *
+ * @since 3.8.0
+ */
+template <class T, class Executor, class CompletionToken>
+auto co_spawn(const std::type_identity_t<Executor>& executor, agrpc::Task<T, Executor> task, CompletionToken&& token)
+{
+    return asio::async_initiate<CompletionToken, detail::TaskSpawnSignatureT<T>>(
+        detail::TaskSpawnInitiation<Executor>{executor}, token, static_cast<agrpc::Task<T, Executor>&&>(task));
+}
+
+/**
+ * @brief (experimental) Traits for `register_coroutine_rpc_handler` that spawn an agrpc::Task for every rpc
+ *
+ * Rpc handlers that return an agrpc::Task can also be registered with `register_awaitable_rpc_handler`, which selects
+ * these traits automatically.
+ *
+ * @tparam Executor The executor type of the Task returned by the rpc handler
+ *
+ * @since 3.8.0
+ */
+template <class Executor = agrpc::GrpcExecutor>
+struct TaskCoroutineTraits
+{
+    /**
+     * @brief The return type of the rpc handler
+     */
+    using ReturnType = agrpc::Task<void, Executor>;
+
+    /**
+     * @brief The completion token used for operations that are initiated on behalf of the rpc
+     */
+    template <class RPCHandler, class CompletionHandler>
+    static agrpc::UseTask completion_token(RPCHandler&, CompletionHandler&) noexcept
+    {
+        return {};
+    }
+
+    /**
+     * @brief Spawn the Task of an rpc
+     */
+    template <class RPCHandler, class CompletionHandler, class IoExecutor, class Function>
+    static void co_spawn(const IoExecutor& io_executor, RPCHandler&, CompletionHandler& completion_handler,
+                         Function&& function)
+    {
+        agrpc::co_spawn<void, Executor>(detail::assoc::get_associated_executor(completion_handler, io_executor),
+                                        static_cast<Function&&>(function)(), detail::RethrowFirstArg{});
+    }
+};
+
+namespace detail
+{
+template <class T, class Executor>
+struct CoroutineTraits<agrpc::Task<T, Executor>> : agrpc::TaskCoroutineTraits<Executor>
+{
+};
+}
+
+AGRPC_NAMESPACE_END
+
+template <class... Args>
+class agrpc::asio::async_result<agrpc::UseTask, void(Args...)>
+{
+  public:
+    template <class Initiation, class RawCompletionToken, class... InitArgs>
+    static auto initiate(Initiation&& initiation, RawCompletionToken&&, InitArgs&&... init_args)
+    {
+        return agrpc::detail::TaskOperation<agrpc::detail::RemoveCrefT<Initiation>,
+                                            std::tuple<agrpc::detail::RemoveCrefT<InitArgs>...>, Args...>{
+            static_cast<Initiation&&>(initiation), static_cast<InitArgs&&>(init_args)...};
+    }
+};
+
+#endif
+
+#endif
+
+#include <agrpc/detail/epilogue.hpp>
+
+#endif  // AGRPC_AGRPC_TASK_HPP
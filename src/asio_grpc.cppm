@@ -29,6 +29,7 @@ module;
 
 #include <agrpc/asio_grpc.hpp>
 #include <agrpc/client_callback.hpp>
+#include <agrpc/grpc_context_pool.hpp>
 #include <agrpc/reactor_ptr.hpp>
 #include <agrpc/server_callback.hpp>
 
@@ -45,6 +46,8 @@ using agrpc::BasicClientReadReactor;
 using agrpc::BasicClientUnaryReactor;
 using agrpc::BasicClientWriteReactor;
 using agrpc::BasicGrpcExecutor;
+using agrpc::BasicPeriodicTimer;
+using agrpc::BasicRPCArena;
 using agrpc::BasicServerBidiReactor;
 using agrpc::BasicServerReadReactor;
 using agrpc::BasicServerUnaryReactor;
@@ -60,13 +63,21 @@ using agrpc::GenericServerRPC;
 using agrpc::GenericStreamingClientRPC;
 using agrpc::GenericUnaryClientRPC;
 using agrpc::GrpcContext;
+using agrpc::GrpcContextPool;
 using agrpc::GrpcExecutor;
+using agrpc::InFlightLimitPolicy;
 using agrpc::make_reactor;
 using agrpc::notify_on_state_change;
+using agrpc::PeriodicTimer;
+using agrpc::PooledMessageFactory;
+using agrpc::Priority;
+using agrpc::priority;
 using agrpc::process_grpc_tag;
 using agrpc::ReactorPtr;
 using agrpc::read;
 using agrpc::register_sender_rpc_handler;
+using agrpc::RPCArena;
+using agrpc::RPCArenaAllocator;
 using agrpc::ServerBidiReactor;
 using agrpc::ServerReadReactor;
 using agrpc::ServerRPC;
@@ -85,9 +96,15 @@ using agrpc::register_callback_rpc_handler;
 using agrpc::register_yield_rpc_handler;
 using agrpc::run;
 using agrpc::run_completion_queue;
+using agrpc::StackPool;
 #ifdef AGRPC_ASIO_HAS_CO_AWAIT
+using agrpc::co_spawn;
 using agrpc::register_awaitable_rpc_handler;
 using agrpc::register_coroutine_rpc_handler;
+using agrpc::Task;
+using agrpc::TaskCoroutineTraits;
+using agrpc::use_task;
+using agrpc::UseTask;
 #endif
 #endif
 }
\ No newline at end of file
@@ -20,6 +20,10 @@
 
 #include <agrpc/alarm.hpp>
 
+#include <optional>
+#include <thread>
+#include <vector>
+
 TEST_CASE_FIXTURE(test::GrpcContextTest, "asio::post a apgrc::Alarm and use variadic-arg callback for its wait")
 {
     bool ok{false};
@@ -130,6 +134,121 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm::cancel")
     CHECK_FALSE(ok);
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm with timer wheel completes waits in deadline order")
+{
+    grpc_context.set_alarm_resolution(std::chrono::milliseconds(1));
+    CHECK_EQ(std::chrono::milliseconds(1), grpc_context.alarm_resolution());
+    std::vector<int> completion_order;
+    agrpc::Alarm alarm1{grpc_context};
+    agrpc::Alarm alarm2{grpc_context};
+    agrpc::Alarm alarm3{grpc_context};
+    const auto deadline1 = test::hundred_milliseconds_from_now();
+    const auto deadline2 = test::ten_milliseconds_from_now();
+    alarm1.wait(deadline1,
+                [&](bool ok)
+                {
+                    CHECK(ok);
+                    CHECK_LE(deadline1, test::now());
+                    completion_order.push_back(1);
+                });
+    alarm2.wait(deadline2,
+                [&](bool ok)
+                {
+                    CHECK(ok);
+                    CHECK_LE(deadline2, test::now());
+                    completion_order.push_back(2);
+                    alarm3.cancel();
+                });
+    alarm3.wait(test::five_seconds_from_now(),
+                [&](bool ok)
+                {
+                    CHECK_FALSE(ok);
+                    completion_order.push_back(3);
+                });
+    const auto not_to_exceed = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+    grpc_context.run();
+    CHECK_GT(not_to_exceed, std::chrono::steady_clock::now());
+    CHECK_EQ(std::vector{2, 3, 1}, completion_order);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm with timer wheel can be cancelled")
+{
+    grpc_context.set_alarm_resolution(std::chrono::milliseconds(1));
+    bool ok{true};
+    std::optional<agrpc::Alarm> alarm{grpc_context};
+    const auto not_to_exceed = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+    SUBCASE("cancel")
+    {
+        alarm->wait(test::five_seconds_from_now(), WaitOkAssigner{ok});
+        post(
+            [&]
+            {
+                alarm->cancel();
+            });
+    }
+    SUBCASE("cancel from another thread")
+    {
+        alarm->wait(test::five_seconds_from_now(), WaitOkAssigner{ok});
+        std::thread{[&]
+                    {
+                        alarm->cancel();
+                    }}
+            .join();
+    }
+    SUBCASE("destruct")
+    {
+        alarm->wait(test::five_seconds_from_now(), WaitOkAssigner{ok});
+        alarm.reset();
+    }
+    grpc_context.run();
+    CHECK_GT(not_to_exceed, std::chrono::steady_clock::now());
+    CHECK_FALSE(ok);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm with timer wheel and destructed GrpcContext")
+{
+    grpc_context_lifetime.emplace();
+    grpc_context.set_alarm_resolution(std::chrono::milliseconds(1));
+    bool invoked{false};
+    agrpc::Alarm{grpc_context}.wait(test::five_seconds_from_now(),
+                                    [&](bool, agrpc::Alarm&&)
+                                    {
+                                        invoked = true;
+                                    });
+    grpc_context.poll();
+    grpc_context_lifetime.reset();
+    CHECK_FALSE(invoked);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm with timer wheel can outlive its GrpcContext after the wait")
+{
+    grpc_context_lifetime.emplace();
+    grpc_context.set_alarm_resolution(std::chrono::milliseconds(1));
+    bool ok{false};
+    agrpc::Alarm alarm{grpc_context};
+    alarm.wait(test::ten_milliseconds_from_now(), WaitOkAssigner{ok});
+    grpc_context.run();
+    grpc_context_lifetime.reset();
+    CHECK(ok);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Alarm with timer wheel cancels the outstanding wait on assignment")
+{
+    grpc_context.set_alarm_resolution(std::chrono::milliseconds(1));
+    bool ok{true};
+    bool other_ok{false};
+    agrpc::Alarm alarm{grpc_context};
+    agrpc::Alarm other_alarm{grpc_context};
+    alarm.wait(test::five_seconds_from_now(), WaitOkAssigner{ok});
+    other_alarm.wait(test::ten_milliseconds_from_now(), WaitOkAssigner{other_ok});
+    const auto not_to_exceed = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+    alarm = std::move(other_alarm);
+    grpc_context.run();
+    CHECK_GT(not_to_exceed, std::chrono::steady_clock::now());
+    CHECK_FALSE(ok);
+    CHECK(other_ok);
+}
+
 #ifdef AGRPC_TEST_ASIO_HAS_CANCELLATION_SLOT
 TEST_CASE_FIXTURE(test::GrpcContextTest, "asio::deferred with Alarm")
 {
@@ -18,6 +18,7 @@
 #include "utils/time.hpp"
 
 #include <agrpc/alarm.hpp>
+#include <agrpc/task.hpp>
 
 #ifdef AGRPC_TEST_HAS_STD_PMR
 #include <memory_resource>
@@ -46,6 +47,76 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "co_spawn two Alarms and await their ok
     CHECK(ok2);
 }
 
+agrpc::Task<int> count_down_task(int n)
+{
+    if (n == 0)
+    {
+        co_return 0;
+    }
+    co_return 1 + co_await count_down_task(n - 1);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Task can await Alarm and other Tasks")
+{
+    bool ok{false};
+    int count{};
+    bool caught{false};
+    std::exception_ptr exception;
+    // The lambda must outlive the Task that it produces
+    const auto function = [&]() -> agrpc::Task<int>
+    {
+        agrpc::Alarm alarm{grpc_context};
+        ok = co_await alarm.wait(test::ten_milliseconds_from_now(), agrpc::use_task);
+        count = co_await count_down_task(10000);
+        try
+        {
+            co_await []() -> agrpc::Task<void>
+            {
+                throw std::runtime_error{"error"};
+                co_return;
+            }();
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        }
+        CHECK_EQ(get_executor(), co_await agrpc::this_task::executor);
+        co_return 42;
+    };
+    agrpc::co_spawn(get_executor(), function(),
+                    [&](std::exception_ptr ep, int value)
+                    {
+                        exception = ep;
+                        CHECK_EQ(42, value);
+                    });
+    grpc_context.run();
+    CHECK(ok);
+    CHECK_EQ(10000, count);
+    CHECK(caught);
+    CHECK_FALSE(exception);
+}
+
+#ifdef AGRPC_TEST_ASIO_HAS_CANCELLATION_SLOT
+TEST_CASE_FIXTURE(test::GrpcContextTest, "agrpc::Task stop request cancels Alarm")
+{
+    bool ok{true};
+    asio::cancellation_signal signal;
+    const auto function = [&]() -> agrpc::Task<void>
+    {
+        agrpc::Alarm alarm{grpc_context};
+        ok = co_await alarm.wait(test::five_seconds_from_now(), agrpc::use_task);
+    };
+    agrpc::co_spawn(get_executor(), function(),
+                    asio::bind_cancellation_slot(signal.slot(), [](std::exception_ptr) {}));
+    post([&]
+         {
+             signal.emit(asio::cancellation_type::all);
+         });
+    grpc_context.run();
+    CHECK_FALSE(ok);
+}
+#endif
+
 #ifdef AGRPC_TEST_HAS_STD_PMR
 TEST_CASE_FIXTURE(test::GrpcContextTest, "co_await Alarm with GrpcExecutor<std::pmr::polymorphic_allocator>")
 {
@@ -20,11 +20,17 @@
 #include "utils/throwing_allocator.hpp"
 #include "utils/time.hpp"
 #include "utils/unassignable_allocator.hpp"
+#include "utils/utility.hpp"
 
 #include <agrpc/alarm.hpp>
+#include <agrpc/detail/coroutine_frame_allocator.hpp>
 #include <agrpc/grpc_context.hpp>
+#include <agrpc/grpc_context_pool.hpp>
 #include <agrpc/grpc_executor.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <forward_list>
 
 #ifdef AGRPC_BOOST_ASIO
@@ -32,6 +38,7 @@
 #endif
 
 #include <thread>
+#include <vector>
 
 TEST_CASE("GrpcExecutor fulfills Executor TS traits")
 {
@@ -53,6 +60,9 @@ TEST_CASE("GrpcExecutor fulfills Executor TS traits")
     CHECK(asio::can_query_v<Exec, asio::execution::mapping_t>);
     CHECK(asio::can_query_v<Exec, asio::execution::allocator_t<void>>);
     CHECK(asio::can_query_v<Exec, asio::execution::context_t>);
+    CHECK(asio::can_require_v<Exec, agrpc::Priority::High>);
+    CHECK(asio::can_prefer_v<Exec, agrpc::Priority::Normal>);
+    CHECK(asio::can_query_v<Exec, agrpc::Priority>);
     CHECK(std::is_constructible_v<asio::any_io_executor, Exec>);
     agrpc::GrpcContext grpc_context{std::make_unique<grpc::CompletionQueue>()};
     auto executor = grpc_context.get_executor();
@@ -71,6 +81,11 @@ TEST_CASE("GrpcExecutor fulfills Executor TS traits")
     CHECK_EQ(asio::execution::outstanding_work_t::untracked,
              asio::query(asio::prefer(tracked_executor, asio::execution::outstanding_work_t::untracked),
                          asio::execution::outstanding_work));
+    auto high_priority_executor = asio::require(executor, agrpc::priority.high);
+    CHECK_EQ(agrpc::priority.high, asio::query(high_priority_executor, agrpc::priority));
+    CHECK_EQ(agrpc::priority.normal,
+             asio::query(asio::require(high_priority_executor, agrpc::priority.normal), agrpc::priority));
+    CHECK_NE(executor, high_priority_executor);
 }
 
 TEST_CASE("GrpcExecutor is mostly trivial")
@@ -98,6 +113,13 @@ TEST_CASE("GrpcExecutorOptions")
         agrpc::detail::set_outstanding_work_tracked(agrpc::detail::GrpcExecutorOptions::BLOCKING_NEVER, true)));
     CHECK_FALSE(agrpc::detail::is_outstanding_work_tracked(agrpc::detail::set_outstanding_work_tracked(
         agrpc::detail::GrpcExecutorOptions::OUTSTANDING_WORK_TRACKED, false)));
+
+    CHECK(agrpc::detail::is_high_priority(agrpc::detail::GrpcExecutorOptions::HIGH_PRIORITY));
+    CHECK_FALSE(agrpc::detail::is_high_priority(agrpc::detail::GrpcExecutorOptions::DEFAULT));
+    CHECK(agrpc::detail::is_high_priority(
+        agrpc::detail::set_high_priority(agrpc::detail::GrpcExecutorOptions::DEFAULT, true)));
+    CHECK_FALSE(agrpc::detail::is_high_priority(
+        agrpc::detail::set_high_priority(agrpc::detail::GrpcExecutorOptions::HIGH_PRIORITY, false)));
 }
 
 struct GrpcExecutorTest : test::GrpcContextTest
@@ -412,6 +434,55 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "post large local allocation")
     CHECK(ok);
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator with large and over-aligned allocations")
+{
+    CHECK_EQ(1024, grpc_context.max_pooled_allocation_size());
+    grpc_context.set_max_pooled_allocation_size(40000);
+    CHECK_EQ(65536, grpc_context.max_pooled_allocation_size());
+    const auto get_used_bytes = [&]
+    {
+        std::size_t used_bytes{};
+        for (const auto& statistics : grpc_context.memory_resource_statistics())
+        {
+            used_bytes += statistics.used_bytes;
+        }
+        return used_bytes;
+    };
+    const auto check_allocation = [&](auto type)
+    {
+        using T = typename decltype(type)::type;
+        post(
+            [&]
+            {
+                using Allocator = std::allocator_traits<decltype(grpc_context.get_allocator())>::rebind_alloc<T>;
+                Allocator allocator{grpc_context.get_allocator()};
+                const auto used_bytes = get_used_bytes();
+                auto* const first = allocator.allocate(1);
+                auto* const second = allocator.allocate(2);
+                CHECK_EQ(0, reinterpret_cast<std::uintptr_t>(first) % alignof(T));
+                CHECK_EQ(0, reinterpret_cast<std::uintptr_t>(second) % alignof(T));
+                CHECK_LT(used_bytes + sizeof(T), get_used_bytes());
+                std::memset(static_cast<void*>(first), 1, sizeof(T));
+                std::memset(static_cast<void*>(second), 2, 2 * sizeof(T));
+                allocator.deallocate(first, 1);
+                allocator.deallocate(second, 2);
+                CHECK_EQ(used_bytes, get_used_bytes());
+            });
+        grpc_context.run();
+    };
+    struct alignas(64) OverAligned
+    {
+        char data[100];
+    };
+    struct alignas(512) VeryOverAligned
+    {
+        char data[3000];
+    };
+    SUBCASE("large") { check_allocation(test::TypeIdentity<std::array<char, 20000>>{}); }
+    SUBCASE("over-aligned") { check_allocation(test::TypeIdentity<OverAligned>{}); }
+    SUBCASE("very over-aligned") { check_allocation(test::TypeIdentity<VeryOverAligned>{}); }
+}
+
 TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator perform many small allocations")
 {
     post(
@@ -431,6 +502,210 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator perform many sm
     grpc_context.run();
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator keeps memory across repeated poll() of two contexts")
+{
+    agrpc::GrpcContext grpc_context2;
+    std::vector<int*> allocations;
+    for (int i{}; i != 10; ++i)
+    {
+        auto& context = i % 2 == 0 ? grpc_context : grpc_context2;
+        asio::post(context,
+                   [&, i]
+                   {
+                       auto allocator = context.get_allocator();
+                       using Allocator = std::allocator_traits<decltype(allocator)>::rebind_alloc<int>;
+                       auto* const value = Allocator{allocator}.allocate(1);
+                       *value = i;
+                       allocations.push_back(value);
+                   });
+        CHECK(context.poll());
+    }
+    for (int i{}; i != 10; ++i)
+    {
+        CHECK_EQ(i, *allocations[i]);
+    }
+    for (int i{}; i != 10; ++i)
+    {
+        auto& context = i % 2 == 0 ? grpc_context : grpc_context2;
+        std::thread{[&]
+                    {
+                        asio::post(context,
+                                   [&, i]
+                                   {
+                                       auto allocator = context.get_allocator();
+                                       using Allocator =
+                                           std::allocator_traits<decltype(allocator)>::rebind_alloc<int>;
+                                       Allocator{allocator}.deallocate(allocations[i], 1);
+                                   });
+                        context.poll();
+                    }}
+            .join();
+    }
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator reuses the memory resources of exited threads")
+{
+    for (int i{}; i != 20; ++i)
+    {
+        std::thread{[&]
+                    {
+                        asio::post(grpc_context,
+                                   [&]
+                                   {
+                                       asio::post(grpc_context, [] {});
+                                   });
+                        grpc_context.poll();
+                    }}
+            .join();
+    }
+    CHECK_EQ(1, grpc_context.memory_resource_statistics().size());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::allocator hands memory back to the thread that allocated it")
+{
+    using Block = std::array<char, 500>;
+    using Allocator = std::allocator_traits<decltype(grpc_context.get_allocator())>::rebind_alloc<Block>;
+    const auto allocate_block = [&]
+    {
+        Block* block{};
+        asio::post(grpc_context,
+                   [&]
+                   {
+                       block = Allocator{grpc_context.get_allocator()}.allocate(1);
+                   });
+        CHECK(grpc_context.poll());
+        return block;
+    };
+    const auto deallocate_block = [&](Block* block)
+    {
+        asio::post(grpc_context,
+                   [&, block]
+                   {
+                       Allocator{grpc_context.get_allocator()}.deallocate(block, 1);
+                   });
+        CHECK(grpc_context.poll());
+    };
+    auto* const block = allocate_block();
+    std::thread{[&]
+                {
+                    deallocate_block(block);
+                }}
+        .join();
+    auto* const reused_block = allocate_block();
+    CHECK_EQ(block, reused_block);
+    std::uint64_t remote_deallocations{};
+    std::uint64_t remote_frees{};
+    for (const auto& statistics : grpc_context.memory_resource_statistics())
+    {
+        remote_deallocations += statistics.remote_deallocations;
+        remote_frees += statistics.remote_frees;
+    }
+    CHECK_EQ(1, remote_deallocations);
+    CHECK_EQ(1, remote_frees);
+    deallocate_block(reused_block);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "Coroutine frames are reused by threads that do and do not run a GrpcContext")
+{
+    const auto allocate_and_deallocate_twice = [](std::size_t frame_size)
+    {
+        void* const frame = agrpc::detail::allocate_coroutine_frame(frame_size);
+        agrpc::detail::deallocate_coroutine_frame(frame);
+        void* const reused_frame = agrpc::detail::allocate_coroutine_frame(frame_size - 8);
+        agrpc::detail::deallocate_coroutine_frame(reused_frame);
+        return frame == reused_frame;
+    };
+    SUBCASE("GrpcContext thread")
+    {
+        grpc_context.set_max_pooled_allocation_size(4096);
+        asio::post(grpc_context,
+                   [&]
+                   {
+                       CHECK(allocate_and_deallocate_twice(300));
+                       CHECK(allocate_and_deallocate_twice(3000));
+                       CHECK(allocate_and_deallocate_twice(10000));
+                   });
+        CHECK(grpc_context.poll());
+    }
+    SUBCASE("other thread")
+    {
+        std::thread{[&]
+                    {
+                        CHECK(allocate_and_deallocate_twice(300));
+                        CHECK(allocate_and_deallocate_twice(3000));
+                    }}
+            .join();
+    }
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext::trim_memory_resources releases chunks without allocated blocks")
+{
+    using Block = std::array<char, 200>;
+    using Allocator = std::allocator_traits<decltype(grpc_context.get_allocator())>::rebind_alloc<Block>;
+    const auto get_statistics = [&]
+    {
+        std::size_t reserved_bytes{};
+        std::size_t used_bytes{};
+        for (const auto& statistics : grpc_context.memory_resource_statistics())
+        {
+            for (const auto& size_class : statistics.size_classes)
+            {
+                if (size_class.block_size >= sizeof(Block) && size_class.block_size < 2 * sizeof(Block))
+                {
+                    reserved_bytes += size_class.reserved_bytes;
+                    used_bytes += size_class.used_bytes;
+                }
+            }
+        }
+        return std::pair{reserved_bytes, used_bytes};
+    };
+    std::vector<Block*> blocks;
+    asio::post(grpc_context,
+               [&]
+               {
+                   for (int i{}; i != 20; ++i)
+                   {
+                       blocks.push_back(Allocator{grpc_context.get_allocator()}.allocate(1));
+                   }
+               });
+    CHECK(grpc_context.poll());
+    const auto [peak_reserved_bytes, peak_used_bytes] = get_statistics();
+    CHECK_LE(20 * sizeof(Block), peak_used_bytes);
+    CHECK_LE(peak_used_bytes, peak_reserved_bytes);
+    const auto deallocate_blocks = [&](std::size_t first)
+    {
+        asio::post(grpc_context,
+                   [&, first]
+                   {
+                       grpc_context.trim_memory_resources();
+                       for (auto i = first; i != blocks.size(); ++i)
+                       {
+                           Allocator{grpc_context.get_allocator()}.deallocate(blocks[i], 1);
+                       }
+                       blocks.resize(first);
+                       asio::post(grpc_context, [] {});
+                   });
+        CHECK(grpc_context.poll());
+    };
+    SUBCASE("partially")
+    {
+        // The first block lives in a chunk of its own
+        deallocate_blocks(1);
+        const auto [reserved_bytes, used_bytes] = get_statistics();
+        CHECK_LT(0, reserved_bytes);
+        CHECK_GT(peak_reserved_bytes, reserved_bytes);
+        CHECK_EQ(peak_used_bytes / 20, used_bytes);
+        deallocate_blocks(0);
+    }
+    SUBCASE("completely")
+    {
+        deallocate_blocks(0);
+        const auto [reserved_bytes, used_bytes] = get_statistics();
+        CHECK_EQ(0, reserved_bytes);
+        CHECK_EQ(0, used_bytes);
+    }
+}
+
 #ifdef AGRPC_BOOST_ASIO
 TEST_CASE_FIXTURE(test::GrpcContextTest, "post with allocator with fancy pointer")
 {
@@ -764,6 +1039,73 @@ void recursively_post(agrpc::GrpcContext& grpc_context)
                });
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run() processes remote work posted while busy and while idle")
+{
+    static constexpr int COUNT = 100;
+    std::atomic_int count{};
+    std::optional guard{test::work_tracking_executor(grpc_context)};
+    std::thread t{[&]
+                  {
+                      for (int i{}; i != COUNT; ++i)
+                      {
+                          post(
+                              [&]
+                              {
+                                  std::this_thread::sleep_for(std::chrono::microseconds(10));
+                                  ++count;
+                              });
+                          if (i % 10 == 0)
+                          {
+                              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                          }
+                      }
+                      post(
+                          [&]
+                          {
+                              guard.reset();
+                          });
+                  }};
+    grpc_context.run();
+    t.join();
+    CHECK_EQ(COUNT, count.load());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest,
+                  "GrpcContext.run_completion_queue() can be stopped from another thread after leaving local work")
+{
+    int count{};
+    std::thread{[&]
+                {
+                    post(
+                        [&]
+                        {
+                            ++count;
+                            post(
+                                [&]
+                                {
+                                    ++count;
+                                });
+                        });
+                }}
+        .join();
+    grpc_context.run_while(
+        [&]
+        {
+            return count < 1;
+        });
+    CHECK_EQ(1, count);
+    std::thread t{[&]
+                  {
+                      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                      grpc_context.stop();
+                  }};
+    CHECK_FALSE(grpc_context.run_completion_queue());
+    t.join();
+    CHECK_EQ(1, count);
+    CHECK(grpc_context.run());
+    CHECK_EQ(2, count);
+}
+
 TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run() is not blocked by repeated asio::posts")
 {
     bool alarm_completed{false};
@@ -821,6 +1163,49 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run() distributes local wo
     CHECK_NE(0, are_both_threads_used.load());
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run() completes local and remote work while all threads are busy")
+{
+    static constexpr auto THREAD_COUNT = 2;
+    static constexpr auto POST_COUNT = 10000;
+    grpc_context_lifetime.emplace(THREAD_COUNT);
+    std::atomic_int counter{};
+    std::optional guard{test::work_tracking_executor(grpc_context)};
+    const auto increment = [&]
+    {
+        if (++counter == 2 * THREAD_COUNT * POST_COUNT)
+        {
+            guard.reset();
+        }
+    };
+    asio::thread_pool pool{2 * THREAD_COUNT};
+    for (size_t i{}; i != THREAD_COUNT; ++i)
+    {
+        post(
+            [&]
+            {
+                for (size_t j{}; j != POST_COUNT; ++j)
+                {
+                    post(increment);
+                }
+            });
+        asio::post(pool,
+                   [&]
+                   {
+                       for (size_t j{}; j != POST_COUNT; ++j)
+                       {
+                           post(increment);
+                       }
+                   });
+        asio::post(pool,
+                   [&]
+                   {
+                       grpc_context.run();
+                   });
+    }
+    pool.join();
+    CHECK_EQ(2 * THREAD_COUNT * POST_COUNT, counter.load());
+}
+
 TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run() interrupted by an exception will not forget local work")
 {
     grpc_context_lifetime.emplace(2);
@@ -896,6 +1281,351 @@ TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run_until() times out corr
     CHECK_FALSE(grpc_context.run_until(test::ten_milliseconds_from_now()));
 }
 
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext busy-poll records time spent spinning and sleeping")
+{
+    SUBCASE("single-threaded") {}
+    SUBCASE("multi-threaded") { grpc_context_lifetime.emplace(2); }
+    CHECK_EQ(std::chrono::nanoseconds::zero(), grpc_context.busy_poll_duration());
+    agrpc::Alarm alarm{grpc_context};
+    bool ok{};
+    SUBCASE("event arrives while spinning")
+    {
+        grpc_context.set_busy_poll_duration(std::chrono::seconds(5));
+        test::wait(alarm, test::ten_milliseconds_from_now(),
+                   [&](bool alarm_ok)
+                   {
+                       ok = alarm_ok;
+                   });
+        grpc_context.run();
+        const auto statistics = grpc_context.busy_poll_statistics();
+        CHECK_LE(1, statistics.spin_events);
+        CHECK_EQ(0, statistics.sleep_events);
+        CHECK_LT(std::chrono::nanoseconds::zero(), statistics.spin_duration);
+    }
+    SUBCASE("event arrives after spinning")
+    {
+        grpc_context.set_busy_poll_duration(std::chrono::microseconds(100));
+        test::wait(alarm, test::hundred_milliseconds_from_now(),
+                   [&](bool alarm_ok)
+                   {
+                       ok = alarm_ok;
+                   });
+        grpc_context.run();
+        const auto statistics = grpc_context.busy_poll_statistics();
+        CHECK_LE(1, statistics.sleep_events);
+        CHECK_LE(std::chrono::microseconds(100), statistics.spin_duration);
+        CHECK_LT(std::chrono::nanoseconds::zero(), statistics.sleep_duration);
+    }
+    CHECK(ok);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run_until() does not busy-poll past the deadline")
+{
+    grpc_context.set_busy_poll_duration(std::chrono::seconds(10));
+    agrpc::Alarm alarm{grpc_context};
+    test::wait(alarm, test::one_second_from_now(), test::NoOp{});
+    const auto start = std::chrono::steady_clock::now();
+    CHECK_FALSE(grpc_context.run_until(test::ten_milliseconds_from_now()));
+    CHECK_GT(std::chrono::seconds(1), std::chrono::steady_clock::now() - start);
+    alarm.cancel();
+    grpc_context.run();
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext with completion queue batch size")
+{
+    SUBCASE("single-threaded") {}
+    SUBCASE("multi-threaded") { grpc_context_lifetime.emplace(2); }
+    CHECK_EQ(1, grpc_context.completion_queue_batch_size());
+    grpc_context.set_completion_queue_batch_size(16);
+    CHECK_EQ(16, grpc_context.completion_queue_batch_size());
+    std::array<std::optional<agrpc::Alarm>, 8> alarms;
+    int count{};
+    SUBCASE("handles all events and local work")
+    {
+        for (auto& alarm : alarms)
+        {
+            test::wait(alarm.emplace(grpc_context), test::now(),
+                       [&](bool)
+                       {
+                           post(
+                               [&]
+                               {
+                                   ++count;
+                               });
+                       });
+        }
+        grpc_context.run();
+        CHECK_EQ(alarms.size(), count);
+    }
+    SUBCASE("stops in the middle of a batch")
+    {
+        for (auto& alarm : alarms)
+        {
+            test::wait(alarm.emplace(grpc_context), test::now(),
+                       [&](bool)
+                       {
+                           if (++count == 1)
+                           {
+                               grpc_context.stop();
+                           }
+                       });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        grpc_context.run();
+        CHECK_EQ(1, count);
+        grpc_context.run();
+        CHECK_EQ(alarms.size(), count);
+    }
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext with local work budget interleaves local work and events")
+{
+    CHECK_EQ(0, grpc_context.local_work_budget());
+    std::vector<int> expected_order;
+    SUBCASE("no budget") { expected_order = {1, 2, 3, 4, 0}; }
+    SUBCASE("budget of two")
+    {
+        grpc_context.set_local_work_budget(2);
+        expected_order = {1, 2, 0, 3, 4};
+    }
+    std::vector<int> order;
+    agrpc::Alarm alarm{grpc_context};
+    post(
+        [&]
+        {
+            for (int i{1}; i != 5; ++i)
+            {
+                post(
+                    [&, i]
+                    {
+                        if (i == 1)
+                        {
+                            test::wait(alarm, test::now(),
+                                       [&](bool)
+                                       {
+                                           order.push_back(0);
+                                       });
+                            // Make sure the alarm has expired
+                            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                        }
+                        order.push_back(i);
+                    });
+            }
+        });
+    grpc_context.run();
+    CHECK_EQ(expected_order, order);
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext tracks work started by local completion handlers")
+{
+    int count{};
+    SUBCASE("nested poll")
+    {
+        post(
+            [&]
+            {
+                post(
+                    [&]
+                    {
+                        ++count;
+                    });
+                post(
+                    [&]
+                    {
+                        ++count;
+                    });
+                grpc_context.poll();
+                CHECK_EQ(2, count);
+                post(
+                    [&]
+                    {
+                        ++count;
+                    });
+            });
+        grpc_context.run();
+        CHECK_EQ(3, count);
+    }
+    SUBCASE("work released by another thread")
+    {
+        std::optional<test::GrpcContextWorkTrackingExecutor> guard;
+        post(
+            [&]
+            {
+                guard.emplace(test::work_tracking_executor(grpc_context));
+                post(
+                    [&]
+                    {
+                        std::thread{[&]
+                                    {
+                                        guard.reset();
+                                    }}
+                            .join();
+                        post(
+                            [&]
+                            {
+                                ++count;
+                            });
+                    });
+            });
+        grpc_context.run();
+        CHECK_EQ(1, count);
+    }
+    SUBCASE("completion handler throws")
+    {
+        post(
+            [&]
+            {
+                post(
+                    [&]
+                    {
+                        ++count;
+                    });
+                throw test::Exception{};
+            });
+        CHECK_THROWS_AS(grpc_context.run(), test::Exception);
+        grpc_context.run();
+        CHECK_EQ(1, count);
+    }
+    CHECK(grpc_context.is_stopped());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest,
+                  "Multithreaded GrpcContext stops once the work that finished on all threads adds up to zero")
+{
+    bool run_completion_queue{};
+    SUBCASE("run()") {}
+    SUBCASE("run_completion_queue()") { run_completion_queue = true; }
+    const auto thread_count = 3;
+    grpc_context_lifetime.emplace(thread_count);
+    std::atomic_int count{};
+    std::vector<std::unique_ptr<agrpc::Alarm>> alarms;
+    for (int i{}; i != 100; ++i)
+    {
+        alarms.emplace_back(std::make_unique<agrpc::Alarm>(grpc_context))
+            ->wait(test::now(),
+                   [&](bool)
+                   {
+                       ++count;
+                       if (!run_completion_queue)
+                       {
+                           post(
+                               [&]
+                               {
+                                   ++count;
+                               });
+                       }
+                   });
+    }
+    std::optional<test::GrpcContextWorkTrackingExecutor> guard{test::work_tracking_executor(grpc_context)};
+    asio::thread_pool pool{thread_count};
+    for (size_t i{}; i != thread_count; ++i)
+    {
+        asio::post(pool,
+                   [&]
+                   {
+                       run_completion_queue ? grpc_context.run_completion_queue() : grpc_context.run();
+                   });
+    }
+    const auto expected_count = run_completion_queue ? 100 : 200;
+    while (count.load() != expected_count)
+    {
+        std::this_thread::yield();
+    }
+    CHECK_FALSE(grpc_context.is_stopped());
+    guard.reset();
+    pool.join();
+    CHECK_EQ(expected_count, count.load());
+    CHECK(grpc_context.is_stopped());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "High priority completion handlers run before normal priority ones")
+{
+    const auto high_priority_executor = asio::require(get_executor(), agrpc::priority.high);
+    std::vector<int> order;
+    SUBCASE("remote")
+    {
+        post(
+            [&]
+            {
+                order.push_back(1);
+            });
+        post(
+            [&]
+            {
+                order.push_back(2);
+            });
+        asio::post(high_priority_executor,
+                   [&]
+                   {
+                       order.push_back(0);
+                   });
+        grpc_context.run();
+        CHECK_EQ(std::vector{0, 1, 2}, order);
+    }
+    SUBCASE("local")
+    {
+        post(
+            [&]
+            {
+                post(
+                    [&]
+                    {
+                        order.push_back(2);
+                        asio::post(high_priority_executor,
+                                   [&]
+                                   {
+                                       order.push_back(3);
+                                   });
+                    });
+                post(
+                    [&]
+                    {
+                        order.push_back(4);
+                    });
+                asio::post(high_priority_executor,
+                           [&]
+                           {
+                               order.push_back(0);
+                           });
+                high_priority_executor.execute(
+                    [&]
+                    {
+                        order.push_back(1);
+                    });
+            });
+        grpc_context.run();
+        CHECK_EQ(std::vector{0, 1, 2, 3, 4}, order);
+    }
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "High priority completion handlers posted from other threads wake up run()")
+{
+    const auto high_priority_executor = asio::require(get_executor(), agrpc::priority.high);
+    std::atomic_int count{};
+    std::optional guard{test::work_tracking_executor(grpc_context)};
+    std::thread thread{[&]
+                       {
+                           grpc_context.run();
+                       }};
+    for (int i{}; i != 20; ++i)
+    {
+        asio::post(high_priority_executor,
+                   [&]
+                   {
+                       ++count;
+                   });
+        post(
+            [&]
+            {
+                ++count;
+            });
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    guard.reset();
+    thread.join();
+    CHECK_EQ(40, count);
+}
+
 TEST_CASE_FIXTURE(test::GrpcContextTest, "GrpcContext.run_while() runs until the expected event")
 {
     SUBCASE("single-threaded") {}
@@ -1004,4 +1734,106 @@ TEST_CASE("asio GrpcExecutor::schedule and destruct GrpcContext")
     CHECK_FALSE(invoked);
     CHECK_FALSE(state.exception);
     CHECK(state.was_done);
-}
\ No newline at end of file
+}
+
+TEST_CASE("GrpcContextPool round-robin and least-loaded selection")
+{
+    agrpc::GrpcContextPool pool{3};
+    CHECK_EQ(3, pool.size());
+    CHECK_EQ(&pool.get_context(0), &pool.next_context());
+    CHECK_EQ(&pool.get_context(1), &pool.next_context());
+    CHECK_EQ(&pool.get_context(2), &pool.next_context());
+    CHECK_EQ(&pool.get_context(0), &pool.next_context());
+    pool.get_context(0).work_started();
+    pool.get_context(1).work_started();
+    for (int i{}; i != 3; ++i)
+    {
+        CHECK_EQ(&pool.get_context(2), &pool.least_loaded_context());
+    }
+    pool.get_context(0).work_finished();
+    pool.get_context(1).work_finished();
+}
+
+TEST_CASE("GrpcContextPool runs work until joined")
+{
+    bool work_stealing{};
+    SUBCASE("no work stealing") {}
+    SUBCASE("work stealing") { work_stealing = true; }
+    agrpc::GrpcContextPool pool{3, work_stealing};
+    std::atomic_int count{};
+    for (int i{}; i != 30; ++i)
+    {
+        asio::post(pool.get_executor(),
+                   [&]
+                   {
+                       ++count;
+                   });
+    }
+    pool.start();
+    pool.join();
+    CHECK_EQ(30, count.load());
+}
+
+TEST_CASE("GrpcContextPool with work stealing executes work of a busy GrpcContext")
+{
+    agrpc::GrpcContextPool pool{2, true};
+    auto& grpc_context = pool.get_context(0);
+    std::atomic_bool first_started{};
+    std::atomic_bool second_completed{};
+    std::thread::id first_id;
+    std::thread::id second_id;
+    const auto wait_for = [](const std::atomic_bool& flag)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!flag && std::chrono::steady_clock::now() < deadline)
+        {
+        }
+    };
+    asio::post(grpc_context,
+               [&]
+               {
+                   first_id = std::this_thread::get_id();
+                   first_started = true;
+                   wait_for(second_completed);
+               });
+    asio::post(grpc_context,
+               [&]
+               {
+                   wait_for(first_started);
+                   second_id = std::this_thread::get_id();
+                   second_completed = true;
+               });
+    pool.start();
+    pool.join();
+    CHECK(second_completed);
+    CHECK_NE(first_id, second_id);
+}
+
+TEST_CASE("GrpcContextPool::stop does not complete pending operations")
+{
+    agrpc::GrpcContextPool pool{2, true};
+    agrpc::Alarm alarm{pool.get_context(1)};
+    bool invoked{};
+    alarm.wait(test::five_seconds_from_now(),
+               [&](bool)
+               {
+                   invoked = true;
+               });
+    pool.start();
+    pool.stop();
+    pool.join();
+    CHECK_FALSE(invoked);
+}
+
+TEST_CASE("GrpcContextPool::stop with work stealing lets join return while work is outstanding")
+{
+    agrpc::GrpcContextPool pool{2, true};
+    std::optional guard{test::work_tracking_executor(pool.get_context(0))};
+    agrpc::Alarm alarm{pool.get_context(1)};
+    alarm.wait(test::five_seconds_from_now(), [](bool) {});
+    pool.start();
+    pool.stop();
+    const auto start = test::now();
+    pool.join();
+    CHECK_LT(test::now() - start, std::chrono::seconds(1));
+}
@@ -0,0 +1,121 @@
+// Copyright 2026 Dennis Hezel
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/asio_utils.hpp"
+#include "utils/doctest.hpp"
+#include "utils/grpc_context_test.hpp"
+#include "utils/time.hpp"
+
+#include <agrpc/periodic_timer.hpp>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+struct PeriodicTimerLoop
+{
+    void operator()(bool ok, std::size_t missed_ticks)
+    {
+        CHECK(ok);
+        CHECK_EQ(std::size_t{}, missed_ticks);
+        completions.push_back(test::now());
+        if (completions.size() < 5)
+        {
+            timer.wait(*this);
+        }
+    }
+
+    agrpc::PeriodicTimer& timer;
+    std::vector<std::chrono::system_clock::time_point>& completions;
+};
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "PeriodicTimer expires at absolute deadlines")
+{
+    SUBCASE("grpc::Alarm") {}
+    SUBCASE("timer wheel") { grpc_context.set_alarm_resolution(std::chrono::milliseconds(1)); }
+    const auto period = std::chrono::milliseconds(20);
+    const auto first_expiry = test::now() + period;
+    agrpc::PeriodicTimer timer{grpc_context, period, first_expiry};
+    CHECK_EQ(period, timer.period());
+    CHECK_EQ(first_expiry, timer.expiry());
+    std::vector<std::chrono::system_clock::time_point> completions;
+    timer.wait(PeriodicTimerLoop{timer, completions});
+    grpc_context.run();
+    REQUIRE_EQ(std::size_t{5}, completions.size());
+    for (std::size_t i{}; i != completions.size(); ++i)
+    {
+        CHECK_LE(first_expiry + period * static_cast<int>(i), completions[i]);
+    }
+    CHECK_EQ(first_expiry + period * 5, timer.expiry());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "PeriodicTimer reports missed ticks")
+{
+    const auto period = std::chrono::milliseconds(20);
+    const auto first_expiry = test::now() + period;
+    agrpc::PeriodicTimer timer{grpc_context, period, first_expiry};
+    bool ok{false};
+    std::size_t missed_ticks{};
+    post(
+        [&]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(75));
+            timer.wait(
+                [&](bool wait_ok, std::size_t wait_missed_ticks)
+                {
+                    ok = wait_ok;
+                    missed_ticks = wait_missed_ticks;
+                });
+        });
+    grpc_context.run();
+    CHECK(ok);
+    CHECK_EQ(std::size_t{2}, missed_ticks);
+    CHECK_EQ(first_expiry + period * 3, timer.expiry());
+}
+
+TEST_CASE_FIXTURE(test::GrpcContextTest, "PeriodicTimer can be cancelled")
+{
+    SUBCASE("grpc::Alarm") {}
+    SUBCASE("timer wheel") { grpc_context.set_alarm_resolution(std::chrono::milliseconds(1)); }
+    bool ok{true};
+    std::size_t missed_ticks{42};
+    std::optional<agrpc::PeriodicTimer> timer{std::in_place, grpc_context, std::chrono::seconds(5)};
+    const auto expiry = timer->expiry();
+    timer->wait(
+        [&](bool wait_ok, std::size_t wait_missed_ticks)
+        {
+            ok = wait_ok;
+            missed_ticks = wait_missed_ticks;
+        });
+    const auto not_to_exceed = std::chrono::steady_clock::now() + std::chrono::seconds(4);
+    SUBCASE("cancel")
+    {
+        post(
+            [&]
+            {
+                timer->cancel();
+            });
+        grpc_context.run();
+        CHECK_EQ(expiry, timer->expiry());
+    }
+    SUBCASE("destruct")
+    {
+        grpc_context.poll();
+        timer.reset();
+        grpc_context.run();
+    }
+    CHECK_GT(not_to_exceed, std::chrono::steady_clock::now());
+    CHECK_FALSE(ok);
+    CHECK_EQ(std::size_t{}, missed_ticks);
+}
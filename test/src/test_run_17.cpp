@@ -242,6 +242,28 @@ TEST_CASE_FIXTURE(
     CHECK_FALSE(has_posted);
 }
 
+TEST_CASE_FIXTURE(RunTest, "agrpc::run asio::post to grpc_context and release its work from io_context")
+{
+    bool invoked{false};
+    std::optional guard{test::work_tracking_executor(grpc_context)};
+    asio::post(io_context,
+               [&]
+               {
+                   test::post(grpc_context,
+                              [&]
+                              {
+                                  invoked = true;
+                              });
+                   guard.reset();
+               });
+    agrpc::run(grpc_context, io_context,
+               [&]
+               {
+                   return invoked;
+               });
+    CHECK(invoked);
+}
+
 TEST_CASE_FIXTURE(RunTest, "agrpc::run runs io_context even when grpc_context is stopped")
 {
     bool posted{false};
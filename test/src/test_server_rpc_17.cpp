@@ -25,10 +25,17 @@
 #include "utils/time.hpp"
 
 #include <agrpc/client_rpc.hpp>
+#include <agrpc/detail/bind_allocator.hpp>
 #include <agrpc/read.hpp>
 #include <agrpc/server_rpc.hpp>
+#include <agrpc/stack_pool.hpp>
 #include <agrpc/waiter.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+
 template <class ServerRPC>
 struct ServerRPCTest : test::ClientServerRPCTest<typename test::IntrospectRPC<ServerRPC>::ClientRPC, ServerRPC>
 {
@@ -449,6 +456,61 @@ TEST_CASE_FIXTURE(ServerRPCTest<test::BidirectionalStreamingServerRPC>,
         });
 }
 
+TEST_CASE_FIXTURE(ServerRPCTest<test::BidirectionalStreamingServerRPC>,
+                  "BidirectionalStreamingServerRPC reads and writes are constructed in the rpc's operation slots")
+{
+    static constexpr int MESSAGE_COUNT = 10;
+    Request request;
+    Response response;
+    std::function<void(ServerRPC::Ptr)> echo = [&](ServerRPC::Ptr ptr)
+    {
+        auto& rpc = *ptr;
+        rpc.read(request, agrpc::detail::AllocatorBinder(
+                              get_allocator(),
+                              [&, ptr = std::move(ptr)](bool ok) mutable
+                              {
+                                  auto& rpc = *ptr;
+                                  if (!ok)
+                                  {
+                                      rpc.finish(grpc::Status::OK,
+                                                 agrpc::detail::AllocatorBinder(get_allocator(),
+                                                                                [ptr = std::move(ptr)](bool) {}));
+                                      return;
+                                  }
+                                  response.set_integer(request.integer());
+                                  rpc.write(response, agrpc::detail::AllocatorBinder(
+                                                          get_allocator(),
+                                                          [&, ptr = std::move(ptr)](bool ok) mutable
+                                                          {
+                                                              if (ok)
+                                                              {
+                                                                  echo(std::move(ptr));
+                                                              }
+                                                          }));
+                              }));
+    };
+    register_callback_and_perform_requests(
+        [&](ServerRPC::Ptr ptr)
+        {
+            echo(std::move(ptr));
+        },
+        [&](auto& request, auto& response, const asio::yield_context& yield)
+        {
+            auto rpc = create_rpc();
+            start_rpc(rpc, request, response, yield);
+            for (int i{}; i < MESSAGE_COUNT; ++i)
+            {
+                request.set_integer(i);
+                CHECK(rpc.write(request, yield));
+                CHECK(rpc.read(response, yield));
+                CHECK_EQ(i, response.integer());
+            }
+            CHECK(rpc.writes_done(yield));
+            CHECK_EQ(grpc::StatusCode::OK, rpc.finish(yield).error_code());
+        });
+    CHECK_FALSE(allocator_has_been_used());
+}
+
 TEST_CASE_FIXTURE(ServerRPCTest<test::GenericServerRPC>, "ServerRPC/ClientRPC generic unary RPC success")
 {
     int option{};
@@ -611,6 +673,27 @@ TEST_CASE_FIXTURE(ServerRPCTest<test::UnaryServerRPC>, "Unary ServerRPC with pro
         });
 }
 
+TEST_CASE_FIXTURE(ServerRPCTest<test::UnaryServerRPC>, "register_yield_rpc_handler obtains stacks from the StackPool")
+{
+    auto& pool = asio::make_service<agrpc::StackPool>(grpc_context, agrpc::StackPool::Options{256 * 1024});
+    register_and_perform_three_requests(
+        [&](ServerRPC& rpc, Request&, const asio::yield_context& yield)
+        {
+            rpc.finish({}, grpc::Status::OK, yield);
+        },
+        [&](auto& request, auto& response, const asio::yield_context& yield)
+        {
+            const auto client_context = test::create_client_context();
+            CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
+        });
+    CHECK_EQ(256 * 1024, pool.options().stack_size);
+#ifdef AGRPC_ASIO_HAS_NEW_SPAWN
+    const auto statistics = pool.statistics();
+    CHECK_LE(4, statistics.allocations);
+    CHECK_EQ(statistics.allocations, statistics.reuses + statistics.pooled_stacks);
+#endif
+}
+
 TEST_CASE("ServerRPC::service_name/method_name")
 {
     const auto check_eq_and_null_terminated = [](std::string_view expected, std::string_view actual)
@@ -707,6 +790,327 @@ TEST_CASE_FIXTURE(ServerRPCTest<test::NotifyWhenDoneClientStreamingServerRPC>, "
 }
 #endif
 
+struct AcceptBacklogTraits : agrpc::DefaultServerRPCTraits
+{
+    static constexpr std::size_t ACCEPT_BACKLOG = 4;
+};
+
+using AcceptBacklogUnaryServerRPC = agrpc::ServerRPC<&test::v1::Test::AsyncService::RequestUnary, AcceptBacklogTraits>;
+
+TEST_CASE_FIXTURE(ServerRPCTest<AcceptBacklogUnaryServerRPC>, "ServerRPC with ACCEPT_BACKLOG handles burst of requests")
+{
+    int handled{};
+    const auto client_function = [&](auto&, auto&, const asio::yield_context& yield)
+    {
+        test::client_perform_unary_success(grpc_context, *stub, yield);
+    };
+    SUBCASE("yield")
+    {
+        register_and_perform_requests(
+            [&](ServerRPC& rpc, Request& request, const asio::yield_context& yield)
+            {
+                ++handled;
+                CHECK_EQ(42, request.integer());
+                Response response;
+                response.set_integer(21);
+                CHECK(rpc.finish(response, grpc::Status::OK, yield));
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    SUBCASE("callback")
+    {
+        register_callback_and_perform_requests(
+            [&](ServerRPC::Ptr ptr, Request& request)
+            {
+                ++handled;
+                CHECK_EQ(42, request.integer());
+                Response response;
+                response.set_integer(21);
+                auto& rpc = *ptr;
+                rpc.finish(response, grpc::Status::OK,
+                           [ptr = std::move(ptr)](bool ok)
+                           {
+                               CHECK(ok);
+                           });
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    CHECK_EQ(6, handled);
+}
+
+template <agrpc::InFlightLimitPolicy Policy>
+struct InFlightLimitTraits : agrpc::DefaultServerRPCTraits
+{
+    static constexpr std::size_t ACCEPT_BACKLOG = 2;
+    static constexpr std::size_t MAX_IN_FLIGHT_RPCS = 2;
+    static constexpr agrpc::InFlightLimitPolicy IN_FLIGHT_LIMIT_POLICY = Policy;
+};
+
+template <agrpc::InFlightLimitPolicy Policy>
+using InFlightLimitUnaryServerRPC =
+    agrpc::ServerRPC<&test::v1::Test::AsyncService::RequestUnary, InFlightLimitTraits<Policy>>;
+
+TEST_CASE_FIXTURE(ServerRPCTest<InFlightLimitUnaryServerRPC<agrpc::InFlightLimitPolicy::PAUSE_ACCEPTING>>,
+                  "ServerRPC with MAX_IN_FLIGHT_RPCS and PAUSE_ACCEPTING holds back requests")
+{
+    int handled{};
+    int in_flight{};
+    int max_in_flight{};
+    const auto client_function = [&](auto&, auto&, const asio::yield_context& yield)
+    {
+        test::client_perform_unary_success(grpc_context, *stub, yield);
+    };
+    const auto handle = [&](const auto& finish, const auto& yield)
+    {
+        ++handled;
+        max_in_flight = (std::max)(max_in_flight, ++in_flight);
+        agrpc::Alarm alarm{grpc_context};
+        alarm.wait(test::hundred_milliseconds_from_now(), yield);
+        --in_flight;
+        Response response;
+        response.set_integer(21);
+        finish(response);
+    };
+    SUBCASE("yield")
+    {
+        register_and_perform_requests(
+            [&](ServerRPC& rpc, Request&, const asio::yield_context& yield)
+            {
+                handle(
+                    [&](const Response& response)
+                    {
+                        CHECK(rpc.finish(response, grpc::Status::OK, yield));
+                    },
+                    yield);
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    SUBCASE("callback")
+    {
+        register_callback_and_perform_requests(
+            [&](ServerRPC::Ptr ptr, Request&)
+            {
+                test::typed_spawn(grpc_context,
+                                  [&, ptr = std::move(ptr)](const asio::yield_context& yield) mutable
+                                  {
+                                      handle(
+                                          [&](const Response& response)
+                                          {
+                                              CHECK(ptr->finish(response, grpc::Status::OK, yield));
+                                          },
+                                          yield);
+                                  });
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    CHECK_EQ(6, handled);
+    CHECK_LE(max_in_flight, 2);
+}
+
+TEST_CASE_FIXTURE(ServerRPCTest<InFlightLimitUnaryServerRPC<agrpc::InFlightLimitPolicy::REJECT>>,
+                  "ServerRPC with MAX_IN_FLIGHT_RPCS and REJECT finishes excess rpcs with RESOURCE_EXHAUSTED")
+{
+    int handled{};
+    int exhausted{};
+    const auto client_function = [&](auto& request, auto& response, const asio::yield_context& yield)
+    {
+        const auto client_context = test::create_client_context();
+        const auto status = request_rpc(*client_context, request, response, yield);
+        if (!status.ok())
+        {
+            CHECK_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED, status.error_code());
+            ++exhausted;
+        }
+    };
+    // Admitted rpcs stay in-flight until every other rpc has been rejected
+    const auto handle = [&](const auto& finish, const auto& yield)
+    {
+        ++handled;
+        agrpc::Alarm alarm{grpc_context};
+        for (int i{}; i != 100 && exhausted != 4; ++i)
+        {
+            alarm.wait(test::ten_milliseconds_from_now(), yield);
+        }
+        finish();
+    };
+    SUBCASE("yield")
+    {
+        register_and_perform_requests(
+            [&](ServerRPC& rpc, Request&, const asio::yield_context& yield)
+            {
+                handle(
+                    [&]
+                    {
+                        CHECK(rpc.finish(Response{}, grpc::Status::OK, yield));
+                    },
+                    yield);
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    SUBCASE("callback")
+    {
+        register_callback_and_perform_requests(
+            [&](ServerRPC::Ptr ptr, Request&)
+            {
+                test::typed_spawn(grpc_context,
+                                  [&, ptr = std::move(ptr)](const asio::yield_context& yield) mutable
+                                  {
+                                      handle(
+                                          [&]
+                                          {
+                                              CHECK(ptr->finish(Response{}, grpc::Status::OK, yield));
+                                          },
+                                          yield);
+                                  });
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    CHECK_EQ(2, handled);
+    CHECK_EQ(4, exhausted);
+}
+
+struct QueueDelayTraits : agrpc::DefaultServerRPCTraits
+{
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_TARGET = std::chrono::milliseconds(1);
+    static constexpr std::chrono::nanoseconds QUEUE_DELAY_INTERVAL = std::chrono::milliseconds(10);
+};
+
+using QueueDelayUnaryServerRPC = agrpc::ServerRPC<&test::v1::Test::AsyncService::RequestUnary, QueueDelayTraits>;
+
+TEST_CASE_FIXTURE(ServerRPCTest<QueueDelayUnaryServerRPC>,
+                  "ServerRPC with QUEUE_DELAY_TARGET sheds rpcs once the GrpcContext falls behind")
+{
+    int handled{};
+    int exhausted{};
+    const auto client_function = [&](auto& request, auto& response, const asio::yield_context& yield)
+    {
+        const auto client_context = test::create_client_context();
+        const auto status = request_rpc(*client_context, request, response, yield);
+        if (!status.ok())
+        {
+            CHECK_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED, status.error_code());
+            ++exhausted;
+        }
+    };
+    // Blocks the GrpcContext so that the completions of the other requests pile up in the completion queue
+    const auto handle = [&]
+    {
+        ++handled;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    };
+    SUBCASE("yield")
+    {
+        register_and_perform_requests(
+            [&](ServerRPC& rpc, Request&, const asio::yield_context& yield)
+            {
+                handle();
+                CHECK(rpc.finish(Response{}, grpc::Status::OK, yield));
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    SUBCASE("callback")
+    {
+        register_callback_and_perform_requests(
+            [&](ServerRPC::Ptr ptr, Request&)
+            {
+                handle();
+                auto& rpc = *ptr;
+                rpc.finish(Response{}, grpc::Status::OK,
+                           [ptr = std::move(ptr)](bool ok)
+                           {
+                               CHECK(ok);
+                           });
+            },
+            client_function, client_function, client_function, client_function, client_function, client_function);
+    }
+    CHECK_LT(0, exhausted);
+    CHECK_EQ(6, handled + exhausted);
+    const auto statistics = grpc_context.queue_delay_statistics();
+    CHECK_EQ(6, statistics.rpcs);
+    CHECK_EQ(exhausted, statistics.rejected_rpcs);
+    CHECK_LT(QueueDelayTraits::QUEUE_DELAY_TARGET, statistics.max_delay);
+}
+
+TEST_CASE_FIXTURE(ServerRPCTest<QueueDelayUnaryServerRPC>,
+                  "ServerRPC with QUEUE_DELAY_TARGET does not shed rpcs that arrive at an idle GrpcContext")
+{
+    int handled{};
+    register_and_perform_requests(
+        [&](ServerRPC& rpc, Request&, const asio::yield_context& yield)
+        {
+            ++handled;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            CHECK(rpc.finish(Response{}, grpc::Status::OK, yield));
+        },
+        [&](auto& request, auto& response, const asio::yield_context& yield)
+        {
+            for (int i{}; i != 6; ++i)
+            {
+                const auto client_context = test::create_client_context();
+                CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
+            }
+        });
+    CHECK_EQ(6, handled);
+    const auto statistics = grpc_context.queue_delay_statistics();
+    CHECK_EQ(6, statistics.rpcs);
+    CHECK_EQ(0, statistics.rejected_rpcs);
+}
+
+struct AllocationCacheTraits : agrpc::DefaultServerRPCTraits
+{
+    static constexpr std::size_t ALLOCATION_CACHE_SIZE = 16;
+};
+
+using AllocationCacheUnaryServerRPC =
+    agrpc::ServerRPC<&test::v1::Test::AsyncService::RequestUnary, AllocationCacheTraits>;
+
+TEST_CASE_FIXTURE(ServerRPCTest<AllocationCacheUnaryServerRPC>,
+                  "ServerRPCPtr with ALLOCATION_CACHE_SIZE reuses the allocation of finished rpcs")
+{
+    std::vector<const Request*> requests;
+    std::vector<std::int32_t> request_integers;
+    std::size_t finished_rpcs{};
+    register_callback_and_perform_three_requests(
+        [&](ServerRPC::Ptr ptr, Request& request)
+        {
+            requests.push_back(&request);
+            request_integers.push_back(request.integer());
+            Response response;
+            response.set_integer(21);
+            auto& rpc = *ptr;
+            rpc.finish(response, grpc::Status::OK,
+                       [&, ptr = std::move(ptr)](bool ok) mutable
+                       {
+                           CHECK(ok);
+                           ptr = {};
+                           ++finished_rpcs;
+                       });
+        },
+        [&](auto&, auto& response, const asio::yield_context& yield)
+        {
+            while (finished_rpcs != requests.size())
+            {
+                agrpc::Alarm{grpc_context}.wait(test::ten_milliseconds_from_now(), yield);
+            }
+            const auto client_context = test::create_client_context();
+            Request request;
+            if (requests.empty())
+            {
+                request.set_integer(42);
+            }
+            CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
+            CHECK_EQ(21, response.integer());
+        });
+    REQUIRE_EQ(std::size_t{3}, requests.size());
+    // The allocation for the next rpc is made when an rpc starts, therefore the first rpc's allocation is reused by the
+    // third rpc.
+    CHECK_EQ(requests[0], requests[2]);
+    // The request message is cleared before reuse
+    CHECK_EQ(42, request_integers[0]);
+    CHECK_EQ(0, request_integers[1]);
+    CHECK_EQ(0, request_integers[2]);
+}
+
 // Callback
 TEST_CASE_TEMPLATE("ServerRPCPtr unary success", RPC, test::UnaryServerRPC, test::NotifyWhenDoneUnaryServerRPC)
 {
@@ -813,3 +1217,60 @@ TEST_CASE_FIXTURE(ServerRPCTest<test::UnaryServerRPC>, "Unary ServerRPCPtr with
             CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
         });
 }
+
+TEST_CASE_FIXTURE(ServerRPCTest<test::UnaryServerRPC>, "Unary ServerRPCPtr with agrpc::RPCArena")
+{
+    register_callback_and_perform_three_requests(
+        test::RPCHandlerWithRPCArena{
+            [&](ServerRPC::Ptr ptr, Request& request, agrpc::RPCArena& arena)
+            {
+                CHECK_EQ(42, request.integer());
+                // The request message and the operation that waited for the request
+                const auto space_used = arena.space_used();
+                CHECK_LT(sizeof(Request), space_used);
+                auto& response = arena.create<Response>();
+                response.set_integer(21);
+                auto& rpc = *ptr;
+                rpc.finish(response, grpc::Status::OK,
+                           arena.bind_allocator(
+                               [ptr = std::move(ptr)](bool ok)
+                               {
+                                   CHECK(ok);
+                               }));
+                CHECK_LT(space_used + sizeof(Response), arena.space_used());
+            }},
+        [&](auto& request, auto& response, const asio::yield_context& yield)
+        {
+            const auto client_context = test::create_client_context();
+            request.set_integer(42);
+            CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
+            CHECK_EQ(21, response.integer());
+        });
+}
+
+TEST_CASE_FIXTURE(ServerRPCTest<test::UnaryServerRPC>,
+                  "Unary ServerRPCPtr with agrpc::RPCArena and agrpc::PooledMessageFactory for responses")
+{
+    register_callback_and_perform_three_requests(
+        test::RPCHandlerWithPooledResponseMessageFactory{
+            [&](ServerRPC::Ptr ptr, Request& request, agrpc::RPCArena&, agrpc::PooledMessageFactory& factory)
+            {
+                CHECK_EQ(42, request.integer());
+                auto& response = factory.create<Response>();
+                response.set_integer(21);
+                auto& rpc = *ptr;
+                rpc.finish(response, grpc::Status::OK,
+                           [ptr = std::move(ptr), &factory, &response](bool ok)
+                           {
+                               CHECK(ok);
+                               factory.destroy(response);
+                           });
+            }},
+        [&](auto& request, auto& response, const asio::yield_context& yield)
+        {
+            const auto client_context = test::create_client_context();
+            request.set_integer(42);
+            CHECK_EQ(grpc::StatusCode::OK, request_rpc(*client_context, request, response, yield).error_code());
+            CHECK_EQ(21, response.integer());
+        });
+}
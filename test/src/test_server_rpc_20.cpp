@@ -29,6 +29,7 @@
 #include <agrpc/register_awaitable_rpc_handler.hpp>
 #include <agrpc/register_coroutine_rpc_handler.hpp>
 #include <agrpc/server_rpc.hpp>
+#include <agrpc/task.hpp>
 #include <agrpc/waiter.hpp>
 
 #ifdef AGRPC_TEST_HAS_BOOST_COBALT
@@ -125,6 +126,65 @@ TEST_CASE_TEMPLATE("Awaitable ServerRPC unary success", RPC, test::UnaryServerRP
         });
 }
 
+TEST_CASE_TEMPLATE("Task ServerRPC unary success", RPC, test::UnaryServerRPC, test::NotifyWhenDoneUnaryServerRPC)
+{
+    ServerRPCAwaitableTest<RPC> test;
+    test.register_and_perform_three_requests(
+        [&](RPC& rpc, test::msg::Request& request) -> agrpc::Task<void>
+        {
+            CHECK_EQ(42, request.integer());
+            typename RPC::Response response;
+            response.set_integer(21);
+            CHECK(co_await rpc.finish(response, grpc::Status::OK, agrpc::use_task));
+        },
+        [&](auto&, auto&, const asio::yield_context& yield)
+        {
+            test::client_perform_unary_success(test.grpc_context, *test.stub, yield);
+        });
+}
+
+TEST_CASE_FIXTURE(ServerRPCAwaitableTest<test::BidirectionalStreamingServerRPC>,
+                  "Task ServerRPC bidi streaming with register_coroutine_rpc_handler and nested tasks")
+{
+    using RPC = test::BidirectionalStreamingServerRPC;
+    static constexpr auto read_and_write = [](RPC& rpc, RPC::Request& request) -> agrpc::Task<bool>
+    {
+        if (!co_await rpc.read(request, agrpc::use_task))
+        {
+            co_return false;
+        }
+        RPC::Response response;
+        response.set_integer(request.integer() + 1);
+        co_return co_await rpc.write(response, agrpc::use_task);
+    };
+    agrpc::register_coroutine_rpc_handler<RPC, agrpc::TaskCoroutineTraits<>>(
+        get_executor(), service,
+        [&](RPC& rpc) -> agrpc::Task<void>
+        {
+            RPC::Request request;
+            while (co_await read_and_write(rpc, request))
+            {
+            }
+            CHECK(co_await rpc.finish(grpc::Status::OK, agrpc::use_task));
+        },
+        test::RethrowFirstArg{});
+    auto client_function = [&](auto& request, auto& response, const asio::yield_context& yield)
+    {
+        auto rpc = create_rpc();
+        start_rpc(rpc, request, response, yield);
+        for (int i{}; i != 3; ++i)
+        {
+            request.set_integer(i);
+            CHECK(rpc.write(request, yield));
+            CHECK(rpc.read(response, yield));
+            CHECK_EQ(i + 1, response.integer());
+        }
+        CHECK(rpc.writes_done(yield));
+        CHECK_EQ(grpc::StatusCode::OK, rpc.finish(yield).error_code());
+    };
+    perform_requests(client_function, client_function);
+}
+
 TEST_CASE_TEMPLATE("Awaitable unary ClientRPC/ServerRPC read/send_initial_metadata successfully", RPC,
                    test::UnaryServerRPC, test::NotifyWhenDoneUnaryServerRPC)
 {
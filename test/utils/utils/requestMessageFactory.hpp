@@ -15,6 +15,8 @@
 #ifndef AGRPC_UTILS_REQUESTMESSAGEFACTORY_HPP
 #define AGRPC_UTILS_REQUESTMESSAGEFACTORY_HPP
 
+#include <agrpc/pooled_message_factory.hpp>
+#include <agrpc/rpc_arena.hpp>
 #include <doctest/doctest.h>
 #include <google/protobuf/arena.h>
 
@@ -55,6 +57,40 @@ struct RPCHandlerWithRequestMessageFactory
 
     Handler handler_;
 };
+
+template <class Handler>
+struct RPCHandlerWithRPCArena
+{
+    explicit RPCHandlerWithRPCArena(Handler handler) : handler_(std::move(handler)) {}
+
+    template <class... Args>
+    decltype(auto) operator()(Args&&... args)
+    {
+        return handler_(static_cast<Args&&>(args)...);
+    }
+
+    agrpc::RPCArena request_message_factory() { return {}; }
+
+    Handler handler_;
+};
+
+template <class Handler>
+struct RPCHandlerWithPooledResponseMessageFactory
+{
+    explicit RPCHandlerWithPooledResponseMessageFactory(Handler handler) : handler_(std::move(handler)) {}
+
+    template <class... Args>
+    decltype(auto) operator()(Args&&... args)
+    {
+        return handler_(static_cast<Args&&>(args)...);
+    }
+
+    agrpc::RPCArena request_message_factory() { return {}; }
+
+    agrpc::PooledMessageFactory response_message_factory() { return {}; }
+
+    Handler handler_;
+};
 }
 
 #endif  // AGRPC_UTILS_REQUESTMESSAGEFACTORY_HPP